@@ -1375,10 +1375,22 @@ SOURCE=.\src\sat\cnf\cnfFast.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfInc.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\cnf\cnfLut.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfSimp.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfMap.c
 # End Source File
 # Begin Source File
@@ -1419,6 +1431,10 @@ SOURCE=.\src\sat\bmc\bmcBmc3.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcBmc3Pth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcBmcAnd.c
 # End Source File
 # Begin Source File
@@ -1451,6 +1467,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -2291,6 +2311,10 @@ SOURCE=.\src\map\if\if.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifCom.c
 # End Source File
 # Begin Source File
@@ -2339,6 +2363,10 @@ SOURCE=.\src\map\if\ifMap.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifMapMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifReduce.c
 # End Source File
 # Begin Source File
@@ -2895,6 +2923,14 @@ SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilTruth.h
 # End Source File
 # End Group
@@ -3703,6 +3739,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -3743,6 +3783,10 @@ SOURCE=.\src\aig\gia\giaPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaRemap.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaResub.c
 # End Source File
 # Begin Source File
@@ -3775,6 +3819,14 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimPth.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSoa.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -4123,6 +4175,14 @@ SOURCE=.\src\proof\cec\cecSolve.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecCube.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\proof\cec\cecWarm.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSweep.c
 # End Source File
 # Begin Source File
@@ -4199,6 +4259,10 @@ SOURCE=.\src\proof\fra\fraCec.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\fra\fraCecPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\fra\fraClass.c
 # End Source File
 # Begin Source File
@@ -4559,6 +4623,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -51,6 +51,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;    
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
+typedef struct Gia_HashMt_t_         Gia_HashMt_t;     
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -182,6 +183,9 @@ struct Gia_Man_t_
     // balancing
     Vec_Int_t *    vSuper;        // supergate
     Vec_Int_t *    vStore;        // node storage  
+    // structure-of-arrays view
+    Vec_Int_t *    vSoaFans;      // fanin literals (two entries per object)
+    int            nSoaObjs;      // the number of objects in the view
 };
 
 
@@ -237,6 +241,7 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nThreads;      // the number of simulation threads
 };
 
 typedef struct Jf_Par_t_ Jf_Par_t; 
@@ -504,6 +509,21 @@ static inline word *       Gia_ObjSimPi( Gia_Man_t * p, int PiId )             {
 static inline word *       Gia_ObjSim( Gia_Man_t * p, int Id )                 { return Vec_WrdEntryP( p->vSims, Id * Gia_ObjSimWords(p) );     }
 static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    { return Gia_ObjSim( p, Gia_ObjId(p, pObj) );                    }
 
+// structure-of-arrays view of the fanins: an AND has two fanin literals, a CO has one
+// followed by -1, a CI or constant has two -1 (the view is extended when used after appending)
+extern void Gia_ManSoaUpdate( Gia_Man_t * p );
+static inline int *        Gia_ManSoaFans( Gia_Man_t * p )                     { if ( p->nSoaObjs != p->nObjs ) Gia_ManSoaUpdate(p); return Vec_IntArray(p->vSoaFans); }
+static inline void         Gia_ManSoaInvalidate( Gia_Man_t * p )               { p->nSoaObjs = 0;                      }
+static inline int          Gia_SoaFanLit0( int * pFans, int i )                { return pFans[2*i];                    }
+static inline int          Gia_SoaFanLit1( int * pFans, int i )                { return pFans[2*i+1];                  }
+static inline int          Gia_SoaFanId0( int * pFans, int i )                 { return Abc_Lit2Var(pFans[2*i]);       }
+static inline int          Gia_SoaFanId1( int * pFans, int i )                 { return Abc_Lit2Var(pFans[2*i+1]);     }
+static inline int          Gia_SoaFanC0( int * pFans, int i )                  { return Abc_LitIsCompl(pFans[2*i]);    }
+static inline int          Gia_SoaFanC1( int * pFans, int i )                  { return Abc_LitIsCompl(pFans[2*i+1]);  }
+static inline int          Gia_SoaIsCi( int * pFans, int i )                   { return pFans[2*i] < 0;                }
+static inline int          Gia_SoaIsCo( int * pFans, int i )                   { return pFans[2*i] >= 0 && pFans[2*i+1] < 0; }
+static inline int          Gia_SoaIsAnd( int * pFans, int i )                  { return pFans[2*i+1] >= 0;             }
+
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
@@ -526,6 +546,8 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
+    if ( p->nSoaObjs > p->nObjs )
+        p->nSoaObjs = p->nObjs;
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -664,6 +686,7 @@ static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0
     assert( Gia_ObjId(p, pObjCo) > Abc_Lit2Var(iLit0) );
     pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
     pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
+    Gia_ManSoaInvalidate( p );
 }
 
 #define GIA_ZER 1
@@ -930,7 +953,9 @@ static inline int         Gia_ObjLutFanin( Gia_Man_t * p, int Id, int i )   { re
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadMt( char * pFileName, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
+extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteIndex );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1032,6 +1057,8 @@ extern void                Gia_ManEquivPrintOne( Gia_Man_t * p, int i, int Count
 extern void                Gia_ManEquivPrintClasses( Gia_Man_t * p, int fVerbose, float Mem );
 extern Gia_Man_t *         Gia_ManEquivReduce( Gia_Man_t * p, int fUseAll, int fDualOut, int fSkipPhase, int fVerbose );
 extern Gia_Man_t *         Gia_ManEquivReduceAndRemap( Gia_Man_t * p, int fSeq, int fMiterPairs );
+extern Gia_Man_t *         Gia_ManEquivReduceAndRemapLits( Gia_Man_t * p, int fSeq, int fMiterPairs, Vec_Int_t * vLits );
+extern void                Gia_ManEquivRemapLits( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManEquivSetColors( Gia_Man_t * p, int fVerbose );
 extern Gia_Man_t *         Gia_ManSpecReduce( Gia_Man_t * p, int fDualOut, int fSynthesis, int fReduce, int fSkipSome, int fVerbose );
 extern Gia_Man_t *         Gia_ManSpecReduceInit( Gia_Man_t * p, Abc_Cex_t * pInit, int nFrames, int fDualOut );
@@ -1083,6 +1110,14 @@ extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
+/*=== giaHashMt.c ===========================================================*/
+extern Gia_HashMt_t *      Gia_HashMtStart( int nCis, int nNodesMax );
+extern void                Gia_HashMtStop( Gia_HashMt_t * p );
+extern int                 Gia_HashMtNodeNum( Gia_HashMt_t * p );
+extern int                 Gia_HashMtIsOverflow( Gia_HashMt_t * p );
+extern int                 Gia_HashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_HashMtDerive( Gia_HashMt_t * p, Vec_Int_t * vRoots, int nRegs );
+extern Gia_Man_t *         Gia_ManDupMt( Gia_Man_t * p, int nThreads );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, int fDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1142,6 +1177,9 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaRemap.c ===========================================================*/
+extern int                 Gia_ManTransferMappingPartial( Gia_Man_t * pOld, Gia_Man_t * pNew );
+extern int                 Gia_ManRemapIncremental( Gia_Man_t * p, Vec_Int_t * vChanged, int nLutSize, int nCutNum, int nTfoLevels, int nRemapMax, int fVerbose );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
@@ -1161,6 +1199,12 @@ extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSiz
 /*=== giaSim.c ============================================================*/
 extern void                Gia_ManSimSetDefaultParams( Gia_ParSim_t * p );
 extern int                 Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+extern void                Gia_ManResetRandom( Gia_ParSim_t * pPars );
+/*=== giaSimPth.c ============================================================*/
+extern void                Gia_ManSimulateWordsMt( Gia_Man_t * p, word * pSims, int nStride, int nWords, int nThreads );
+extern int                 Gia_ManSimSimulateMt( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+/*=== giaSoa.c ============================================================*/
+extern int                 Gia_ManSoaLevelNum( Gia_Man_t * p );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -1273,6 +1317,7 @@ extern Tas_Man_t *         Tas_ManAlloc( Gia_Man_t * pAig, int nBTLimit );
 extern void                Tas_ManStop( Tas_Man_t * p );
 extern Vec_Int_t *         Tas_ReadModel( Tas_Man_t * p );
 extern void                Tas_ManSatPrintStats( Tas_Man_t * p );
+extern void                Tas_ManSetLearning( Tas_Man_t * p, int nLearntMax, int nLearntKeep );
 extern int                 Tas_ManSolve( Tas_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pObj2 );
 extern int                 Tas_ManSolveArray( Tas_Man_t * p, Vec_Ptr_t * vObjs );
 
@@ -22,6 +22,24 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/zlib/zlib.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +49,30 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the reader of the gzipped AIGER file, which decodes the AND gates while
+// decompressing; the text before and after the AND gates is kept in vText
+typedef struct Gia_AigerGz_t_ Gia_AigerGz_t;
+struct Gia_AigerGz_t_
+{
+    gzFile           pFile;        // the compressed file
+    Vec_Str_t *      vText;        // the text before and after the AND gates
+    unsigned char *  pBuf;         // the decompressed chunk
+    int              nBuf;         // the number of bytes in the chunk
+    int              iBuf;         // the current byte in the chunk
+    int              fEof;         // the file ended in the middle of a number
+};
+
+#define GIA_AIGER_GZ_CHUNK (1 << 16)
+
+// The index of the AND gates (extension "x") is written for large AIGs on
+// request (&w -x), so that the AND gates can be decoded by several threads.
+// It is the last extension and contains the number of AND gates in one
+// chunk, the number of chunks, the byte offset of each chunk from the
+// beginning of the AND gates (two 4-byte words, the upper one first), and
+// the size once again, so that the index can be found looking back from
+// the comment text.
+#define GIA_AIGER_INDEX_STEP (1 << 16)
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -160,20 +202,334 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     }
 */
     return vBinary;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the gzipped AIGER file without decompressing it whole.]
+
+  Description [Gia_AigerGzStart() reads the header and the CO literals
+  into vText and stops at the AND gates, which are then decoded from the
+  stream by Gia_AigerGzUnsigned(). Gia_AigerGzReadRest() appends the text
+  following the AND gates (symbols, comments, extensions) to vText. This
+  way, only the small part of the file is kept in memory.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_AigerGzByte( Gia_AigerGz_t * p )
+{
+    if ( p->iBuf == p->nBuf )
+    {
+        p->nBuf = gzread( p->pFile, p->pBuf, GIA_AIGER_GZ_CHUNK );
+        p->iBuf = 0;
+        if ( p->nBuf <= 0 )
+        {
+            p->nBuf = 0;
+            return -1;
+        }
+    }
+    return p->pBuf[p->iBuf++];
+}
+static inline unsigned Gia_AigerGzUnsigned( Gia_AigerGz_t * p )
+{
+    unsigned x = 0, i = 0;
+    int ch;
+    while ( (ch = Gia_AigerGzByte(p)) >= 0 && (ch & 0x80) )
+        x |= (ch & 0x7f) << (7 * i++);
+    if ( ch < 0 )
+    {
+        p->fEof = 1;
+        return 0;
+    }
+    return x | (ch << (7 * i));
+}
+static int Gia_AigerGzCopyLine( Gia_AigerGz_t * p )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzByte(p)) >= 0 )
+    {
+        Vec_StrPush( p->vText, (char)ch );
+        if ( ch == '\n' )
+            return 1;
+    }
+    return 0;
+}
+static int Gia_AigerGzCopyUnsigned( Gia_AigerGz_t * p )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzByte(p)) >= 0 )
+    {
+        Vec_StrPush( p->vText, (char)ch );
+        if ( !(ch & 0x80) )
+            return 1;
+    }
+    return 0;
+}
+void Gia_AigerGzStop( Gia_AigerGz_t * p )
+{
+    gzclose( p->pFile );
+    Vec_StrFree( p->vText );
+    ABC_FREE( p->pBuf );
+    ABC_FREE( p );
+}
+Gia_AigerGz_t * Gia_AigerGzStart( char * pFileName )
+{
+    Gia_AigerGz_t * p;
+    int nCounts[9] = {0}, nCos, i, fOk;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_AigerGzStart(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    p = ABC_CALLOC( Gia_AigerGz_t, 1 );
+    p->pFile = pFile;
+    p->vText = Vec_StrAlloc( 1000 );
+    p->pBuf  = ABC_ALLOC( unsigned char, GIA_AIGER_GZ_CHUNK );
+    // read the parameters (M I L O A + B C J F)
+    fOk = Gia_AigerGzCopyLine( p );
+    Vec_StrPush( p->vText, 0 );
+    if ( fOk )
+        fOk = sscanf( Vec_StrArray(p->vText), "%*s %d %d %d %d %d %d %d %d %d", nCounts, nCounts+1, nCounts+2, nCounts+3, nCounts+4, nCounts+5, nCounts+6, nCounts+7, nCounts+8 ) >= 5;
+    Vec_StrPop( p->vText );
+    if ( !fOk || Vec_StrSize(p->vText) < 4 || strncmp(Vec_StrArray(p->vText), "aig", 3) )
+    {
+        printf( "Gia_AigerGzStart(): The file is not in the binary AIGER format.\n" );
+        Gia_AigerGzStop( p );
+        return NULL;
+    }
+    // copy the literals of the latches and the POs
+    nCos = nCounts[2] + nCounts[3] + nCounts[5] + nCounts[6] + nCounts[7] + nCounts[8];
+    for ( i = 0; fOk && i < nCos; i++ )
+        fOk = Vec_StrEntry(p->vText, 3) == ' ' ? Gia_AigerGzCopyLine(p) : Gia_AigerGzCopyUnsigned(p);
+    if ( !fOk )
+    {
+        printf( "Gia_AigerGzStart(): The file is truncated.\n" );
+        Gia_AigerGzStop( p );
+        return NULL;
+    }
+    return p;
+}
+static void Gia_AigerGzReadRest( Gia_AigerGz_t * p )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzByte(p)) >= 0 )
+        Vec_StrPush( p->vText, (char)ch );
+    // the parser may look past the end of the text
+    Vec_StrPush( p->vText, 0 );
+    Vec_StrPop( p->vText );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the index of the AND gates.]
+
+  Description [Returns the pointer to the offsets of the chunks or NULL
+  if the index is absent or does not match the AND gates starting at pAnds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned char * Gia_AigerFindIndex( char * pContents, iword nFileSize, unsigned char * pAnds, int nAnds, int * pnStep )
+{
+    char * pComment = "\nThis file was produced by the GIA package";
+    unsigned char * pEnd, * pIndex, * pStop = (unsigned char *)pContents + nFileSize;
+    int nLength = strlen(pComment), nSize, nStep, nChunks, i;
+    iword Offset, OffsetPrev = -1;
+    // find the comment following the index
+    for ( pEnd = pStop - nLength; pEnd > pAnds && pEnd > pStop - 1000; pEnd-- )
+        if ( *pEnd == '\n' && !strncmp((char *)pEnd, pComment, nLength) )
+            break;
+    if ( pEnd <= pAnds || pEnd <= pStop - 1000 )
+        return NULL;
+    // check the size written before and after the index
+    nSize = Gia_AigerReadInt( pEnd - 4 );
+    if ( nSize < 12 || (iword)nSize + 5 > pEnd - pAnds )
+        return NULL;
+    pIndex = pEnd - nSize - 5;
+    if ( *pIndex != 'x' || Gia_AigerReadInt(pIndex + 1) != nSize )
+        return NULL;
+    nStep   = Gia_AigerReadInt( pIndex + 5 );
+    nChunks = Gia_AigerReadInt( pIndex + 9 );
+    if ( nStep <= 0 || nChunks != (nAnds + nStep - 1) / nStep || nSize != 4 * (3 + 2 * nChunks) )
+        return NULL;
+    // check the offsets
+    pIndex += 13;
+    for ( i = 0; i < nChunks; i++ )
+    {
+        Offset = ((iword)(unsigned)Gia_AigerReadInt(pIndex + 8*i) << 32) | (iword)(unsigned)Gia_AigerReadInt(pIndex + 8*i + 4);
+        if ( (i == 0 && Offset != 0) || Offset <= OffsetPrev || Offset >= pEnd - pAnds )
+            return NULL;
+        OffsetPrev = Offset;
+    }
+    *pnStep = nStep;
+    return pIndex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND gates using several threads.]
+
+  Description [Each thread decodes a range of chunks starting at the
+  offset given by the index. If the AIG is not strashed, the threads
+  fill the objects of the AIG directly. Otherwise, the threads decode
+  the fanin literals, which are then strashed in the original order.
+  Returns the pointer to the end of the AND gates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerThData_t_
+{
+    Gia_Man_t *      pNew;         // the AIG (if the AND gates are not strashed)
+    int *            pLits;        // the fanin literals (if the AND gates are strashed)
+    unsigned char *  pAnds;        // the beginning of the AND gates
+    unsigned char *  pIndex;       // the offsets of the chunks
+    unsigned char *  pStop;        // the end of the last chunk
+    int              nCis;         // the number of CIs
+    int              nAnds;        // the number of AND gates
+    int              nStep;        // the number of AND gates in one chunk
+    int              iChunkStart;  // the first chunk of this thread
+    int              iChunkStop;   // the chunk following the last one of this thread
+    int              nThreads;     // the number of threads
+} Gia_AigerThData_t;
+
+void * Gia_AigerDecodeThread( void * pArg )
+{
+    Gia_AigerThData_t * pData = (Gia_AigerThData_t *)pArg;
+    unsigned char * pIndex = pData->pIndex + 8 * pData->iChunkStart;
+    iword Offset = ((iword)(unsigned)Gia_AigerReadInt(pIndex) << 32) | (iword)(unsigned)Gia_AigerReadInt(pIndex + 4);
+    unsigned char * pCur = pData->pAnds + Offset;
+    int iStart = pData->iChunkStart * pData->nStep;
+    int iStop  = Abc_MinInt( pData->iChunkStop * pData->nStep, pData->nAnds );
+    unsigned uLit0, uLit1, uLit;
+    Gia_Obj_t * pObj;
+    int i, iObj;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        uLit  = ((i + 1 + pData->nCis) << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pData->pLits )
+        {
+            pData->pLits[2*i+0] = uLit0;
+            pData->pLits[2*i+1] = uLit1;
+            continue;
+        }
+        // same as Gia_ManAppendAnd()
+        iObj = i + 1 + pData->nCis;
+        pObj = pData->pNew->pObjs + iObj;
+        if ( uLit0 < uLit1 )
+        {
+            pObj->iDiff0  = iObj - Abc_Lit2Var(uLit0);
+            pObj->fCompl0 = Abc_LitIsCompl(uLit0);
+            pObj->iDiff1  = iObj - Abc_Lit2Var(uLit1);
+            pObj->fCompl1 = Abc_LitIsCompl(uLit1);
+        }
+        else
+        {
+            pObj->iDiff1  = iObj - Abc_Lit2Var(uLit0);
+            pObj->fCompl1 = Abc_LitIsCompl(uLit0);
+            pObj->iDiff0  = iObj - Abc_Lit2Var(uLit1);
+            pObj->fCompl0 = Abc_LitIsCompl(uLit1);
+        }
+    }
+    if ( iStop == pData->nAnds )
+        pData->pStop = pCur;
+#ifdef ABC_USE_PTHREADS
+    if ( pData->nThreads > 1 )
+        pthread_exit( NULL );
+#endif
+    return NULL;
+}
+static unsigned char * Gia_AigerDecodeMt( Gia_Man_t * pNew, Vec_Int_t * vNodes, unsigned char * pAnds, unsigned char * pIndex, int nStep, int nAnds, int fSkipStrash, int nThreads )
+{
+    Gia_AigerThData_t * pData;
+    unsigned char * pStop = NULL;
+    int nCis = Gia_ManCiNum(pNew);
+    int nChunks = (nAnds + nStep - 1) / nStep;
+    int * pLits = fSkipStrash ? NULL : ABC_ALLOC( int, 2 * nAnds );
+    int i, iNode0, iNode1;
+    assert( Gia_ManObjNum(pNew) == 1 + nCis && Vec_IntSize(vNodes) == 1 + nCis );
+    assert( pNew->nObjsAlloc >= 1 + nCis + nAnds );
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, nChunks) );
+    pData = ABC_CALLOC( Gia_AigerThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].pNew        = pNew;
+        pData[i].pLits       = pLits;
+        pData[i].pAnds       = pAnds;
+        pData[i].pIndex      = pIndex;
+        pData[i].nCis        = nCis;
+        pData[i].nAnds       = nAnds;
+        pData[i].nStep       = nStep;
+        pData[i].iChunkStart = (int)((iword)nChunks * i / nThreads);
+        pData[i].iChunkStop  = (int)((iword)nChunks * (i + 1) / nThreads);
+        pData[i].nThreads    = nThreads;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( pThreads + i, NULL, Gia_AigerDecodeThread, (void *)(pData + i) );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( pThreads[i], NULL );
+            assert( status == 0 );
+        }
+        ABC_FREE( pThreads );
+    }
+    else
+#endif
+        Gia_AigerDecodeThread( pData );
+    pStop = pData[nThreads-1].pStop;
+    ABC_FREE( pData );
+    if ( fSkipStrash )
+    {
+        // the AND gates are already in place
+        for ( i = 0; i < nAnds; i++ )
+            Vec_IntPush( vNodes, Abc_Var2Lit(pNew->nObjs++, 0) );
+        return pStop;
+    }
+    Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nAnds; i++ )
+    {
+        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, pLits[2*i+0] >> 1), pLits[2*i+0] & 1 );
+        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, pLits[2*i+1] >> 1), pLits[2*i+1] & 1 );
+        Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+    }
+    Gia_ManHashStop( pNew );
+    ABC_FREE( pLits );
+    return pStop;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If pGz is given, pContents contains the text preceding the
+  AND gates, which are decoded from the stream. If nThreads > 1 and the
+  file contains the index of the AND gates, they are decoded by several
+  threads. The file size is 64-bit, so that huge mapped files can be read.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, iword nFileSize, Gia_AigerGz_t * pGz, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
@@ -181,8 +537,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned char * pDrivers, * pSymbols, * pCur, * pIndex;
     unsigned uLit0, uLit1, uLit;
+    int nStep;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -282,24 +639,58 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
     }
 
     // create the AND gates
-    if ( !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
-    {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( fSkipStrash )
-            Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
-        else
-            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+    if ( nThreads > 1 && pGz == NULL && (pIndex = Gia_AigerFindIndex(pContents, nFileSize, pCur, nAnds, &nStep)) )
+        pCur = Gia_AigerDecodeMt( pNew, vNodes, pCur, pIndex, nStep, nAnds, fSkipStrash, nThreads );
+    else
+    {
+        if ( !fSkipStrash )
+            Gia_ManHashAlloc( pNew );
+        for ( i = 0; i < nAnds; i++ )
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            if ( pGz )
+            {
+                uLit1 = uLit  - Gia_AigerGzUnsigned( pGz );
+                uLit0 = uLit1 - Gia_AigerGzUnsigned( pGz );
+                if ( pGz->fEof )
+                    break;
+            }
+            else
+            {
+                uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+                uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            }
+//            assert( uLit1 > uLit0 );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+            assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
+            if ( fSkipStrash )
+                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+            else
+                Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        }
+        if ( !fSkipStrash )
+            Gia_ManHashStop( pNew );
     }
-    if ( !fSkipStrash )
-        Gia_ManHashStop( pNew );
+    if ( pGz && pGz->fEof )
+    {
+        fprintf( stdout, "The file is truncated in the middle of the AND gates.\n" );
+        Vec_IntFreeP( &vLits );
+        Vec_IntFree( vNodes );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
+
+    // append the text following the AND gates
+    if ( pGz )
+    {
+        iword iCur = pCur - (unsigned char *)pContents, iDrivers = pDrivers - (unsigned char *)pContents;
+        Gia_AigerGzReadRest( pGz );
+        pContents = Vec_StrArray( pGz->vText );
+        nFileSize = Vec_StrSize( pGz->vText );
+        pCur      = (unsigned char *)pContents + iCur;
+        pDrivers  = (unsigned char *)pContents + iDrivers;
+    }
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -467,7 +858,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
                 pName = pCur;          while ( *pCur++ != '\n' );
                 *(pCur-1) = 0;
                 // assign the name
-                Vec_IntWriteEntry( vPoNames, iTerm, pName - (unsigned char *)pContents );
+                Vec_IntWriteEntry( vPoNames, iTerm, pName - pCurOld );
             } 
 
             // check that all names are assigned
@@ -479,12 +870,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
                 {
                     if ( Entry == ~0 )
                         continue;
-                    if ( strncmp( pContents+Entry, "constraint:", 11 ) == 0 )
+                    if ( strncmp( (char *)pCurOld+Entry, "constraint:", 11 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 1 );
                         nConstr++;
                     }
-                    if ( strncmp( pContents+Entry, "invariant:", 10 ) == 0 )
+                    if ( strncmp( (char *)pCurOld+Entry, "invariant:", 10 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 2 );
                         nInvars++;
@@ -701,6 +1092,13 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
                 pCur += 4*Vec_IntSize(pNew->vObjClasses);
                 if ( fVerbose ) printf( "Finished reading extension \"v\".\n" );
             }
+            // skip the index of the AND gates
+            else if ( *pCur == 'x' )
+            {
+                pCur++;
+                pCur += Gia_AigerReadInt(pCur) + 4;
+                if ( fVerbose ) printf( "Finished reading extension \"x\".\n" );
+            }
             else break;
         }
     }
@@ -788,12 +1186,75 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
         Abc_Print( 0, "Structural hashing enabled while reading AIGER may have invalidated the mapping.  Consider using \"&r -s\".\n" );
     return pNew;
 }
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fSkipStrash, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns NULL if the file cannot be mapped. The mapping is
+  private and writable because the parser terminates the names in place.
+  The file is read sequentially, which is communicated to the kernel,
+  so that it can read ahead and drop the pages already parsed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerMapFile( char * pFileName, iword * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    size_t nSize;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    nSize = (size_t)Stat.st_size;
+    pContents = (char *)mmap( NULL, nSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == MAP_FAILED )
+        return NULL;
+    // the bytes past the end of the file are zero, unless the file ends on a page boundary,
+    // in which case reading past the end of a malformed file would crash
+    if ( nSize % (size_t)sysconf(_SC_PAGESIZE) == 0 && pContents[nSize-1] != '\n' )
+    {
+        munmap( pContents, nSize );
+        return NULL;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, nSize, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (iword)nSize;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+static void Gia_AigerUnmapFile( char * pContents, iword nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
 
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The gzipped files (*.gz) are decoded while decompressing.
+  Other files are decoded directly from the memory-mapped file. If the
+  file cannot be mapped, it is read into a buffer. If the file contains
+  the index of the AND gates, they are decoded by nThreads threads.]
   
   SideEffects []
 
@@ -801,27 +1262,58 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadMt( pFileName, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadMt( char * pFileName, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
+    Gia_AigerGz_t * pGz;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    iword nFileSize;
+    int RetValue, fGzip;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    fGzip = strlen(pFileName) > 3 && !strcmp(pFileName+strlen(pFileName)-3, ".gz");
+    if ( fGzip )
+    {
+        // decode the AND gates while decompressing
+        pGz = Gia_AigerGzStart( pFileName );
+        if ( pGz == NULL )
+            return NULL;
+        pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(pGz->vText), Vec_StrSize(pGz->vText), pGz, fSkipStrash, fCheck, 1 );
+        Gia_AigerGzStop( pGz );
+    }
+    else if ( (pContents = Gia_AigerMapFile( pFileName, &nFileSize )) )
+    {
+        // decode the AIG directly from the mapped file
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fSkipStrash, fCheck, nThreads );
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( fGzip ) // also remove the extension preceding ".gz"
+        {
+            char * pTemp = Gia_FileNameGeneric( pName );
+            ABC_FREE( pName );
+            pName = pTemp;
+        }
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
@@ -996,23 +1488,26 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If fWriteIndex is set and the AIG has at least two chunks
+  of AND gates, the index of the AND gates is written as the last extension.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteIndex )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
+    Vec_Wrd_t * vIndex = NULL;
     int i, nBufferSize, Pos;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
+    word Offset;
 //    assert( Gia_ManIsNormalized(pInit) );
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
@@ -1082,8 +1577,12 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Pos = 0;
     nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    if ( fWriteIndex && Gia_ManAndNum(p) >= 2 * GIA_AIGER_INDEX_STEP )
+        vIndex = Vec_WrdAlloc( Gia_ManAndNum(p) / GIA_AIGER_INDEX_STEP + 1 );
     Gia_ManForEachAnd( p, pObj, i )
     {
+        if ( vIndex && (i - Gia_ManCiNum(p) - 1) % GIA_AIGER_INDEX_STEP == 0 )
+            Vec_WrdPush( vIndex, (word)Pos );
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
@@ -1094,6 +1593,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         {
             printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
 	        fclose( pFile );
+            Vec_WrdFreeP( &vIndex );
             if ( p != pInit )
                 Gia_ManStop( p );
             return;
@@ -1290,6 +1790,22 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fwrite( p->pName, 1, strlen(p->pName), pFile );
         fprintf( pFile, "%c", '\0' );
     }
+    // write the index of the AND gates (should be the last extension)
+    if ( vIndex )
+    {
+        int nSize = 4 * (3 + 2 * Vec_WrdSize(vIndex));
+        fprintf( pFile, "x" );
+        Gia_FileWriteBufferSize( pFile, nSize );
+        Gia_FileWriteBufferSize( pFile, GIA_AIGER_INDEX_STEP );
+        Gia_FileWriteBufferSize( pFile, Vec_WrdSize(vIndex) );
+        Vec_WrdForEachEntry( vIndex, Offset, i )
+        {
+            Gia_FileWriteBufferSize( pFile, (int)(Offset >> 32) );
+            Gia_FileWriteBufferSize( pFile, (int)(Offset & 0xFFFFFFFF) );
+        }
+        Gia_FileWriteBufferSize( pFile, nSize );
+        Vec_WrdFree( vIndex );
+    }
     // write comments
     fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
     fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
@@ -1302,6 +1818,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+{
+    Gia_AigerWriteS( pInit, pFileName, fWriteSymbols, fCompact, 0 );
+}
 
 /**Function*************************************************************
 
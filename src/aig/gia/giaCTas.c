@@ -50,6 +50,9 @@ struct Tas_Par_t_
     int           fUseHighest;  // use node with the highest ID
     int           fUseLowest;   // use node with the highest ID
     int           fUseMaxFF;    // use node with the largest fanin fanout
+    // learned clauses
+    int           nLearntMax;   // the max size of the learned clause store kept across calls (0 = not kept)
+    int           nLearntKeep;  // the max size of learned clauses kept when the store is reduced
     // other
     int           fVerbose;
 };
@@ -95,6 +98,8 @@ struct Tas_Man_t_
     int *         pWatches;     // watched lists for each literal
     Vec_Int_t *   vWatchLits;   // lits whose watched are assigned
     int           nClauses;     // the counter of clauses
+    int           nClausesMax;  // the max number of clauses in the store
+    int           nReduces;     // the number of learned clause store reductions
     // activity
     float *       pActivity;    // variable activity
     Vec_Int_t *   vActiveVars;  // variables with activity
@@ -168,6 +173,8 @@ void Tas_SetDefaultParams( Tas_Par_t * pPars )
     pPars->fUseHighest =           1;   // use node with the highest ID
     pPars->fUseLowest  =           0;   // use node with the lowest ID
     pPars->fUseMaxFF   =           0;   // use node with the largest fanin fanout
+    pPars->nLearntMax  =           0;   // the max size of the learned clause store kept across calls
+    pPars->nLearntKeep =           8;   // the max size of learned clauses kept when the store is reduced
     pPars->fVerbose    =           1;   // print detailed statistics
     pPars->VarDecay    = (float)0.95;   // variable decay
     pPars->VarInc      =         1.0;   // variable increment
@@ -236,6 +243,27 @@ void Tas_ManStop( Tas_Man_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Keeps the learned clauses across the calls to the solver.]
+
+  Description [The learned clauses are derived from the AIG structure
+  alone and remain valid for any later call made on the same AIG. When
+  the clause store exceeds nLearntMax words, only the clauses with at most
+  nLearntKeep literals are kept. If nLearntMax is 0, the learned clauses
+  are removed after each call.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Tas_ManSetLearning( Tas_Man_t * p, int nLearntMax, int nLearntKeep )
+{
+    p->Pars.nLearntMax  = nLearntMax;
+    p->Pars.nLearntKeep = nLearntKeep;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns satisfying assignment.]
@@ -1036,6 +1064,78 @@ static inline int Tas_ManCreateFromCls( Tas_Man_t * p, Tas_Cls_t * pCls, int Lev
     return Tas_QueFinish( pQue );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Removes all clauses from the store.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Tas_ManClearLearnt( Tas_Man_t * p )
+{
+    int i, Entry;
+    p->pStore.iCur = 16;
+    Vec_IntForEachEntry( p->vWatchLits, Entry, i )
+        p->pWatches[Entry] = 0;
+    Vec_IntClear( p->vWatchLits );
+    p->nClauses = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reduces the learned clause store after the call.]
+
+  Description [Should be called when all variables are unassigned.
+  The clauses that are kept are compacted and watched again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Tas_ManReduceLearnt( Tas_Man_t * p )
+{
+    Tas_Cls_t * pCls;
+    int i, Entry, h, hNew, nSize;
+    p->nClausesMax = Abc_MaxInt( p->nClausesMax, p->nClauses );
+    if ( p->Pars.nLearntMax == 0 )
+    {
+        Tas_ManClearLearnt( p );
+        return;
+    }
+    if ( p->pStore.iCur < p->Pars.nLearntMax )
+        return;
+    p->nReduces++;
+    // remove the watches
+    Vec_IntForEachEntry( p->vWatchLits, Entry, i )
+        p->pWatches[Entry] = 0;
+    Vec_IntClear( p->vWatchLits );
+    // compact the short clauses and watch them again
+    p->nClauses = 0;
+    for ( h = hNew = 16; h < p->pStore.iCur; h += nSize )
+    {
+        pCls = Tas_ClsFromHandle( p, h );
+        nSize = pCls->nLits + 3;
+        if ( pCls->nLits > p->Pars.nLearntKeep )
+            continue;
+        memmove( p->pStore.pData + hNew, p->pStore.pData + h, sizeof(int) * nSize );
+        pCls = Tas_ClsFromHandle( p, hNew );
+        pCls->iNext[0] = pCls->iNext[1] = 0;
+        Tas_ManWatchClause( p, pCls, pCls->pLits[0] );
+        Tas_ManWatchClause( p, pCls, pCls->pLits[1] );
+        hNew += nSize;
+        p->nClauses++;
+    }
+    p->pStore.iCur = hNew;
+    // start from scratch if the short clauses take too much room
+    if ( p->pStore.iCur >= p->Pars.nLearntMax / 2 )
+        Tas_ManClearLearnt( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Propagate one assignment.]
@@ -1388,13 +1488,7 @@ int Tas_ManSolve( Tas_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pObj2 )
     p->pClauses.iHead = p->pClauses.iTail = 1;
     // clauses
     if ( p->nClauses > 0 )
-    {
-        p->pStore.iCur = 16;
-        Vec_IntForEachEntry( p->vWatchLits, Entry, i )
-            p->pWatches[Entry] = 0;
-        Vec_IntClear( p->vWatchLits );
-        p->nClauses = 0;
-    }
+        Tas_ManReduceLearnt( p );
     // activity
     Vec_IntForEachEntry( p->vActiveVars, Entry, i )
         p->pActivity[Entry] = 0.0;
@@ -1447,13 +1541,7 @@ int Tas_ManSolveArray( Tas_Man_t * p, Vec_Ptr_t * vObjs )
     p->pClauses.iHead = p->pClauses.iTail = 1;
     // clauses
     if ( p->nClauses > 0 )
-    {
-        p->pStore.iCur = 16;
-        Vec_IntForEachEntry( p->vWatchLits, Entry, i )
-            p->pWatches[Entry] = 0;
-        Vec_IntClear( p->vWatchLits );
-        p->nClauses = 0;
-    }
+        Tas_ManReduceLearnt( p );
     // activity
     Vec_IntForEachEntry( p->vActiveVars, Entry, i )
         p->pActivity[Entry] = 0.0;
@@ -1500,6 +1588,9 @@ void Tas_ManSatPrintStats( Tas_Man_t * p )
     printf( "Undef calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUndec, p->nSatTotal? 100.0*p->nSatUndec/p->nSatTotal :0.0, p->nSatUndec? 1.0*p->nConfUndec/p->nSatUndec : 0.0 );
     ABC_PRTP( "Time", p->timeSatUndec, p->timeTotal );
+    if ( p->Pars.nLearntMax )
+        printf( "Learned clauses: Max = %d.  Final = %d.  Store = %d words.  Reductions = %d.\n",
+            p->nClausesMax, p->nClauses, p->pStore.iCur, p->nReduces );
     ABC_PRT( "Total time", p->timeTotal );
 }
 
@@ -1537,6 +1628,7 @@ Vec_Int_t * Tas_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvSt
     // create logic network
     p = Tas_ManAlloc( pAig, nConfs );
     p->pAig   = pAig;
+    Tas_ManSetLearning( p, 1 << 20, 8 );
     // create resulting data-structures
     vStatus   = Vec_StrAlloc( Gia_ManPoNum(pAig) );
     vCexStore = Vec_IntAlloc( 10000 );
@@ -492,6 +492,7 @@ void Gia_ManEquivFixOutputPairs( Gia_Man_t * p )
         pObj1->iDiff0  = Gia_ObjId(p, pObj1);
         pObj1->fCompl0 = 0;
     }
+    Gia_ManSoaInvalidate( p );
 }
 
 /**Function*************************************************************
@@ -624,18 +625,47 @@ Gia_Man_t * Gia_ManEquivRemapDfs( Gia_Man_t * p )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Translates literals of the AIG into literals of its copy.]
+
+  Description [Assumes that the copy was just derived and the Value field
+  of each object of p points to its literal in the copy (or is ~0 if the
+  object was dropped). Entries of vLits equal to -1 are left unchanged.
+  Entries pointing to the dropped objects are set to -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManEquivRemapLits( Gia_Man_t * p, Vec_Int_t * vLits )
+{
+    Gia_Obj_t * pObj;
+    int i, iLit;
+    Vec_IntForEachEntry( vLits, iLit, i )
+    {
+        if ( iLit < 0 )
+            continue;
+        pObj = Gia_ManObj( p, Abc_Lit2Var(iLit) );
+        Vec_IntWriteEntry( vLits, i, ~pObj->Value ? Abc_LitNotCond(pObj->Value, Abc_LitIsCompl(iLit)) : -1 );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reduces AIG while remapping equivalence classes.]
 
-  Description [Drops the pairs of outputs if they are proved equivalent.]
+  Description [Drops the pairs of outputs if they are proved equivalent.
+  If vLits is not NULL, it contains literals of p, which are translated
+  into the literals of the resulting AIG.]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManEquivReduceAndRemap( Gia_Man_t * p, int fSeq, int fMiterPairs )
+Gia_Man_t * Gia_ManEquivReduceAndRemapLits( Gia_Man_t * p, int fSeq, int fMiterPairs, Vec_Int_t * vLits )
 {
     Gia_Man_t * pNew, * pFinal;
     pNew = Gia_ManEquivReduce( p, 0, 0, 0, 0 );
@@ -648,13 +678,23 @@ Gia_Man_t * Gia_ManEquivReduceAndRemap( Gia_Man_t * p, int fSeq, int fMiterPairs
     else
         Gia_ManCombMarkUsed( pNew );
     Gia_ManEquivUpdatePointers( p, pNew );
+    if ( vLits )
+        Gia_ManEquivRemapLits( p, vLits );
     pFinal = Gia_ManDupMarked( pNew );
     Gia_ManEquivDeriveReprs( p, pNew, pFinal );
+    if ( vLits )
+        Gia_ManEquivRemapLits( pNew, vLits );
     Gia_ManStop( pNew );
     pFinal = Gia_ManEquivRemapDfs( pNew = pFinal );
+    if ( vLits )
+        Gia_ManEquivRemapLits( pNew, vLits );
     Gia_ManStop( pNew );
     return pFinal;
 }
+Gia_Man_t * Gia_ManEquivReduceAndRemap( Gia_Man_t * p, int fSeq, int fMiterPairs )
+{
+    return Gia_ManEquivReduceAndRemapLits( p, fSeq, fMiterPairs, NULL );
+}
 
 /**Function*************************************************************
 
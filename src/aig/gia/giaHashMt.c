@@ -0,0 +1,413 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structural hashing shared by several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaHashMt.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The table is an array of 64-bit keys (two fanin literals) with linear
+// probing. A thread adding a node claims an empty slot with compare-and-swap,
+// takes the next node number with fetch-and-add, records the fanins, and
+// publishes the node number in the slot. A thread finding the key before
+// the node number is published waits for it. Nodes are never deleted.
+//
+// The literals of the table refer to the constant (0), the CIs (1..nCis),
+// and the nodes of the table (nCis+1+i for the i-th node). The node numbers
+// depend on the order in which the threads came, so the resulting AIG is
+// derived by Gia_HashMtDerive(), which renumbers the nodes by a DFS from
+// the roots and does not depend on this order.
+
+struct Gia_HashMt_t_
+{
+    int              nCis;         // the number of CIs
+    int              nNodesMax;    // the max number of nodes
+    volatile int     nNodes;       // the number of nodes
+    volatile int     fOverflow;    // set when the table is full
+    int              nMask;        // the table size minus one
+    volatile word *  pKeys;        // the keys of the table
+    volatile int *   pValues;      // the node numbers plus one
+    int *            pFanins;      // the fanin literals of the nodes
+};
+
+static inline word Gia_HashMtCas( volatile word * p, word Old, word New )
+{
+#ifdef _MSC_VER
+    return (word)InterlockedCompareExchange64( (volatile LONG64 *)p, (LONG64)New, (LONG64)Old );
+#else
+    return __sync_val_compare_and_swap( p, Old, New );
+#endif
+}
+static inline int Gia_HashMtFetchAdd( volatile int * p, int Value )
+{
+#ifdef _MSC_VER
+    return (int)InterlockedExchangeAdd( (volatile LONG *)p, (LONG)Value );
+#else
+    return __sync_fetch_and_add( p, Value );
+#endif
+}
+static inline void Gia_HashMtBarrier()
+{
+#ifdef _MSC_VER
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+static inline unsigned Gia_HashMtKey( word Key )
+{
+    Key ^= Key >> 33;
+    Key *= ABC_CONST(0xff51afd7ed558ccd);
+    Key ^= Key >> 33;
+    return (unsigned)Key;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the shared table.]
+
+  Description [The table can store up to nNodesMax nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashMt_t * Gia_HashMtStart( int nCis, int nNodesMax )
+{
+    Gia_HashMt_t * p;
+    int nSize = 1 << Abc_Base2Log( 2 * Abc_MaxInt(nNodesMax, 16) );
+    p = ABC_CALLOC( Gia_HashMt_t, 1 );
+    p->nCis      = nCis;
+    p->nNodesMax = nNodesMax;
+    p->nMask     = nSize - 1;
+    p->pKeys     = ABC_CALLOC( word, nSize );
+    p->pValues   = ABC_CALLOC( int, nSize );
+    p->pFanins   = ABC_ALLOC( int, 2 * Abc_MaxInt(nNodesMax, 1) );
+    return p;
+}
+void Gia_HashMtStop( Gia_HashMt_t * p )
+{
+    ABC_FREE( p->pKeys );
+    ABC_FREE( p->pValues );
+    ABC_FREE( p->pFanins );
+    ABC_FREE( p );
+}
+int Gia_HashMtNodeNum( Gia_HashMt_t * p )
+{
+    return p->nNodes;
+}
+int Gia_HashMtIsOverflow( Gia_HashMt_t * p )
+{
+    return p->fOverflow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the AND gate.]
+
+  Description [Can be called by several threads at the same time.
+  Returns -1 if the table is full.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_HashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 )
+{
+    word Key, Old;
+    int i, iNode;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = ((word)iLit0 << 32) | (word)iLit1;
+    for ( i = Gia_HashMtKey(Key) & p->nMask; ; i = (i + 1) & p->nMask )
+    {
+        Old = p->pKeys[i];
+        if ( Old == 0 )
+            Old = Gia_HashMtCas( p->pKeys + i, 0, Key );
+        if ( Old == 0 ) // the slot is claimed by this thread
+        {
+            iNode = Gia_HashMtFetchAdd( &p->nNodes, 1 );
+            if ( iNode >= p->nNodesMax )
+            {
+                p->fOverflow = 1;
+                p->pValues[i] = -1;
+                return -1;
+            }
+            p->pFanins[2*iNode+0] = iLit0;
+            p->pFanins[2*iNode+1] = iLit1;
+            Gia_HashMtBarrier();
+            p->pValues[i] = iNode + 1;
+            return Abc_Var2Lit( p->nCis + 1 + iNode, 0 );
+        }
+        if ( Old != Key )
+            continue;
+        // wait till the node is published by the thread that claimed the slot
+        while ( (iNode = p->pValues[i]) == 0 )
+            ;
+        Gia_HashMtBarrier();
+        return iNode < 0 ? -1 : Abc_Var2Lit( p->nCis + iNode, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG with the given roots.]
+
+  Description [The CIs are created first, in the same order. The nodes
+  are created in the DFS order from the roots. Because the order of the
+  fanins in the table depends on the node numbers, the DFS visits first
+  the fanin with the smaller structural signature, which depends only on
+  the structure of the fanin cone. This way, the result does not depend
+  on the order in which the threads added the nodes. Each entry of vRoots
+  becomes a CO.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_HashMtSigLit( word * pSigs, int nCis, int iLit )
+{
+    int iNode = Abc_Lit2Var(iLit) - nCis - 1;
+    word Sig = iNode < 0 ? (word)Gia_HashMtKey((word)Abc_Lit2Var(iLit)) * ABC_CONST(0x9E3779B97F4A7C15) : pSigs[iNode];
+    return Abc_LitIsCompl(iLit) ? ~Sig : Sig;
+}
+void Gia_HashMtDeriveSigs( Gia_HashMt_t * p, word * pSigs )
+{
+    word Sig0, Sig1;
+    int i;
+    // the fanins of a node are added to the table before the node
+    for ( i = 0; i < p->nNodes; i++ )
+    {
+        Sig0 = Gia_HashMtSigLit( pSigs, p->nCis, p->pFanins[2*i+0] );
+        Sig1 = Gia_HashMtSigLit( pSigs, p->nCis, p->pFanins[2*i+1] );
+        if ( Sig0 > Sig1 )
+            ABC_SWAP( word, Sig0, Sig1 );
+        pSigs[i] = (word)Gia_HashMtKey(Sig0 ^ (Sig1 >> 1)) * ABC_CONST(0xC2B2AE3D27D4EB4F) + Gia_HashMtKey(Sig1 + Sig0);
+    }
+}
+int Gia_HashMtDerive_rec( Gia_Man_t * pNew, Gia_HashMt_t * p, word * pSigs, int * pCopy, int iVar )
+{
+    int iNode = iVar - p->nCis - 1, iLit0, iLit1;
+    if ( iNode < 0 )
+        return Abc_Var2Lit( iVar, 0 );
+    if ( pCopy[iNode] >= 0 )
+        return pCopy[iNode];
+    iLit0 = p->pFanins[2*iNode+0];
+    iLit1 = p->pFanins[2*iNode+1];
+    if ( Gia_HashMtSigLit(pSigs, p->nCis, iLit0) > Gia_HashMtSigLit(pSigs, p->nCis, iLit1) )
+        ABC_SWAP( int, iLit0, iLit1 );
+    iLit0 = Abc_LitNotCond( Gia_HashMtDerive_rec(pNew, p, pSigs, pCopy, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0) );
+    iLit1 = Abc_LitNotCond( Gia_HashMtDerive_rec(pNew, p, pSigs, pCopy, Abc_Lit2Var(iLit1)), Abc_LitIsCompl(iLit1) );
+    return pCopy[iNode] = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+}
+Gia_Man_t * Gia_HashMtDerive( Gia_HashMt_t * p, Vec_Int_t * vRoots, int nRegs )
+{
+    Gia_Man_t * pNew, * pTemp;
+    word * pSigs;
+    int * pCopy, i, iLit;
+    assert( !p->fOverflow );
+    pCopy = ABC_FALLOC( int, Abc_MaxInt(p->nNodes, 1) );
+    pSigs = ABC_ALLOC( word, Abc_MaxInt(p->nNodes, 1) );
+    Gia_HashMtDeriveSigs( p, pSigs );
+    pNew = Gia_ManStart( 1 + p->nCis + p->nNodes + Vec_IntSize(vRoots) );
+    Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < p->nCis; i++ )
+        Gia_ManAppendCi( pNew );
+    Vec_IntForEachEntry( vRoots, iLit, i )
+    {
+        iLit = Abc_LitNotCond( Gia_HashMtDerive_rec(pNew, p, pSigs, pCopy, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+        Gia_ManAppendCo( pNew, iLit );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, nRegs );
+    // remove the dangling nodes, if any
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    ABC_FREE( pCopy );
+    ABC_FREE( pSigs );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the AIG with structural hashing using several threads.]
+
+  Description [Each thread duplicates the cones of every nThreads-th CO
+  and keeps its own copies of the objects. The nodes shared by the cones
+  of different threads are merged by the table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_HashMtThData_t_
+{
+    Gia_Man_t *      p;            // the AIG to duplicate
+    Gia_HashMt_t *   pHash;        // the shared table
+    Vec_Int_t *      vRoots;       // the literals of the CO drivers
+    int              iThread;      // the thread number
+    int              nThreads;     // the number of threads
+} Gia_HashMtThData_t;
+
+void * Gia_ManDupMtThread( void * pArg )
+{
+    Gia_HashMtThData_t * pData = (Gia_HashMtThData_t *)pArg;
+    Gia_Man_t * p = pData->p;
+    Gia_Obj_t * pObj;
+    int * pCopy = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    int i, iLit0, iLit1;
+    // mark the cones of the COs of this thread (-2) in the reverse topological order,
+    // so that the threads, whose stacks are small, do not recurse through deep AIGs
+    for ( i = pData->iThread; i < Gia_ManCoNum(p); i += pData->nThreads )
+        pCopy[Gia_ObjFaninId0p(p, Gia_ManCo(p, i))] = -2;
+    for ( i = Gia_ManObjNum(p) - 1; i > 0; i-- )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( pCopy[i] != -2 || !Gia_ObjIsAnd(pObj) )
+            continue;
+        pCopy[Gia_ObjFaninId0(pObj, i)] = -2;
+        pCopy[Gia_ObjFaninId1(pObj, i)] = -2;
+    }
+    pCopy[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pCopy[Gia_ObjId(p, pObj)] = Abc_Var2Lit( 1 + i, 0 );
+    // add the marked nodes in the topological order (-1 means that the table is full)
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( pCopy[i] != -2 )
+            continue;
+        iLit0 = pCopy[Gia_ObjFaninId0(pObj, i)];
+        iLit1 = pCopy[Gia_ObjFaninId1(pObj, i)];
+        if ( iLit0 < 0 || iLit1 < 0 )
+            pCopy[i] = -1;
+        else
+            pCopy[i] = Gia_HashMtAnd( pData->pHash, Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond(iLit1, Gia_ObjFaninC1(pObj)) );
+    }
+    for ( i = pData->iThread; i < Gia_ManCoNum(p); i += pData->nThreads )
+    {
+        pObj  = Gia_ManCo( p, i );
+        iLit0 = pCopy[Gia_ObjFaninId0p(p, pObj)];
+        Vec_IntWriteEntry( pData->vRoots, i, iLit0 < 0 ? 0 : Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)) );
+    }
+    ABC_FREE( pCopy );
+#ifdef ABC_USE_PTHREADS
+    if ( pData->nThreads > 1 )
+        pthread_exit( NULL );
+#endif
+    return NULL;
+}
+Gia_Man_t * Gia_ManDupMt( Gia_Man_t * p, int nThreads )
+{
+    Gia_HashMtThData_t * pData;
+    Gia_HashMt_t * pHash;
+    Gia_Man_t * pNew;
+    Vec_Int_t * vRoots;
+    int i;
+    assert( p->pMuxes == NULL );
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, Gia_ManCoNum(p)) );
+    pHash  = Gia_HashMtStart( Gia_ManCiNum(p), Gia_ManAndNum(p) );
+    vRoots = Vec_IntStart( Gia_ManCoNum(p) );
+    pData  = ABC_CALLOC( Gia_HashMtThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].p        = p;
+        pData[i].pHash    = pHash;
+        pData[i].vRoots   = vRoots;
+        pData[i].iThread  = i;
+        pData[i].nThreads = nThreads;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( pThreads + i, NULL, Gia_ManDupMtThread, (void *)(pData + i) );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( pThreads[i], NULL );
+            assert( status == 0 );
+        }
+        ABC_FREE( pThreads );
+    }
+    else
+#endif
+        Gia_ManDupMtThread( pData );
+    // the duplicate cannot have more nodes than the original
+    assert( !Gia_HashMtIsOverflow(pHash) );
+    pNew = Gia_HashMtDerive( pHash, vRoots, Gia_ManRegNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_HashMtStop( pHash );
+    Vec_IntFree( vRoots );
+    ABC_FREE( pData );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
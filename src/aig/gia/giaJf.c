@@ -63,6 +63,7 @@ struct Jf_Man_t_
     Vec_Flt_t        vRefs;       // ref counters
     Vec_Set_t        pMem;        // cut storage
     Vec_Int_t *      vTemp;       // temporary
+    int *            pFans;       // fanin literals (structure-of-arrays view)
     float (*pCutCmp) (Jf_Cut_t *, Jf_Cut_t *);// procedure to compare cuts
     abctime          clkStart;    // starting time
     word             CutCount[4]; // statistics
@@ -1147,11 +1148,11 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
     for ( i = 0; i <= CutNum+1; i++ )
         pSto[i] = Sto + i, pSto[i]->Cost = 0, pSto[i]->iFunc = ~0;
     // compute signatures
-    pCuts0 = Jf_ObjCuts( p, Gia_ObjFaninId0(pObj, iObj) );
+    pCuts0 = Jf_ObjCuts( p, Gia_SoaFanId0(p->pFans, iObj) );
     Jf_ObjForEachCut( pCuts0, pCut0, i )
         Sign0[i] = Jf_CutGetSign( pCut0 );
     // compute signatures
-    pCuts1 = Jf_ObjCuts( p, Gia_ObjFaninId1(pObj, iObj) );
+    pCuts1 = Jf_ObjCuts( p, Gia_SoaFanId1(p->pFans, iObj) );
     Jf_ObjForEachCut( pCuts1, pCut1, i )
         Sign1[i] = Jf_CutGetSign( pCut1 );
     // merge cuts
@@ -1255,6 +1256,7 @@ void Jf_ManComputeCuts( Jf_Man_t * p, int fEdge )
         printf( "Computing cuts...\r" );
         fflush( stdout );
     }
+    p->pFans = Gia_ManSoaFans( p->pGia );
     Gia_ManForEachObj( p->pGia, pObj, i )
     {
         if ( Gia_ObjIsCi(pObj) || Gia_ObjIsBuf(pObj) )
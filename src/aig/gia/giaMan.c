@@ -81,6 +81,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_PtrFreeFree( p->vNamesOut );
     Vec_IntFreeP( &p->vSuper );
     Vec_IntFreeP( &p->vStore );
+    Vec_IntFreeP( &p->vSoaFans );
     Vec_IntFreeP( &p->vClassNew );
     Vec_IntFreeP( &p->vClassOld );
     Vec_WrdFreeP( &p->vSims );
@@ -149,6 +150,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
     Memory += sizeof(int) * p->nHTable * (p->pHTable != NULL);
+    Memory += sizeof(int) * (p->vSoaFans ? Vec_IntCap(p->vSoaFans) : 0);
     return Memory;
 }
 
@@ -0,0 +1,835 @@
+/**CFile****************************************************************
+
+  FileName    [giaRemap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental LUT mapping after local changes.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaRemap.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+#include "misc/vec/vecMem.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_RMP_LEAF_MAX     8    // the max number of LUT inputs
+#define GIA_RMP_CUT_MAX     16    // the max number of cuts per node
+#define GIA_RMP_CONE_MAX  1000    // the max number of AND nodes in a reused LUT
+
+// the state of a node
+enum {
+    GIA_RMP_NONE = 0,             // not used by the old mapping
+    GIA_RMP_KEEP,                 // the old LUT is kept
+    GIA_RMP_DIRTY,                // the old LUT is missing, invalid, or changed
+    GIA_RMP_TFO                   // the old LUT is in the TFO of a dirty node
+};
+
+typedef struct Gia_RmpCut_t_ Gia_RmpCut_t;
+struct Gia_RmpCut_t_
+{
+    word           Sign;          // signature
+    int            Delay;         // arrival time
+    float          Flow;          // area flow
+    int            nLeaves;       // the number of leaves
+    int            pLeaves[GIA_RMP_LEAF_MAX]; // the leaves
+};
+
+typedef struct Gia_RmpMan_t_ Gia_RmpMan_t;
+struct Gia_RmpMan_t_
+{
+    Gia_Man_t *    pGia;          // the AIG
+    int            nLutSize;      // the LUT size
+    int            nCutNum;       // the max number of cuts per node
+    int            fArea;         // the cuts are compared by area flow
+    Vec_Str_t *    vState;        // the node states
+    Vec_Int_t *    vSlot;         // the cutset of each remapped node (or -1)
+    Vec_Int_t *    vNodes;        // the remapped nodes in topological order
+    Gia_RmpCut_t * pCuts;         // the cutsets of the remapped nodes
+    int *          pnCuts;        // the number of cuts in each cutset
+    Vec_Int_t *    vArr;          // arrival times
+    Vec_Int_t *    vReq;          // required times
+    Vec_Flt_t *    vFlow;         // area flows
+    Vec_Flt_t *    vRefs;         // estimated fanout counts
+    Vec_Int_t *    vMapRefs;      // fanout counts in the current mapping
+    Gia_RmpCut_t   pTemp[GIA_RMP_CUT_MAX+1]; // the cutset under construction
+    // statistics
+    int            nDirty;        // the number of dirty nodes
+    int            nTfo;          // the number of reselected nodes in the TFO
+};
+
+static inline int            Gia_RmpSlot( Gia_RmpMan_t * p, int iObj )      { return Vec_IntEntry(p->vSlot, iObj);                   }
+static inline Gia_RmpCut_t * Gia_RmpCuts( Gia_RmpMan_t * p, int iObj )      { return p->pCuts + Gia_RmpSlot(p, iObj) * p->nCutNum;  }
+static inline int            Gia_RmpCutNum( Gia_RmpMan_t * p, int iObj )    { return p->pnCuts[Gia_RmpSlot(p, iObj)];               }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the objects of the old AIG with those of the new AIG.]
+
+  Description [Both AIGs are simulated with the same random patterns
+  applied to the CIs with the same index. An object of the old AIG is
+  matched with the object of the new AIG pointed to by its copy literal
+  (Value), if their simulation signatures are equal up to complementation.
+  Otherwise, it is matched with the first object of the new AIG having
+  this signature. This way, the copy literals, which are stale after the
+  AIG is derived by a sequence of commands, are only used as a hint.
+  Returns the array mapping the old objects into the new ones (or -1).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_RmpSimNormalize( word * pSim, word * pRes, int nWords )
+{
+    int w, fCompl = (int)(pSim[0] & 1);
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] = fCompl ? ~pSim[w] : pSim[w];
+}
+static word * Gia_RmpSimulate( Gia_Man_t * p, word * pCis, int nWords )
+{
+    word * pSims = ABC_CALLOC( word, (size_t)nWords * Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachCi( p, pObj, i )
+        memcpy( pSims + nWords * Gia_ObjId(p, pObj), pCis + nWords * i, sizeof(word) * nWords );
+    Gia_ManSimulateWordsMt( p, pSims, nWords, nWords, 1 );
+    return pSims;
+}
+static Vec_Int_t * Gia_RmpMatchObjects( Gia_Man_t * pOld, Gia_Man_t * pNew, int nWords )
+{
+    Vec_Int_t * vOld2New = Vec_IntStartFull( Gia_ManObjNum(pOld) );
+    Vec_Int_t * vSig2New = Vec_IntAlloc( Gia_ManObjNum(pNew) );
+    Vec_Mem_t * vSigs = Vec_MemAlloc( nWords, 12 );
+    word * pCis, * pSimsOld, * pSimsNew, * pSig = ABC_ALLOC( word, nWords ), * pTemp = ABC_ALLOC( word, nWords );
+    Gia_Obj_t * pObj;
+    int i, w, iCopy, * pSpot;
+    // simulate both AIGs
+    Gia_ManRandom( 1 );
+    pCis = ABC_ALLOC( word, (size_t)nWords * Gia_ManCiNum(pOld) );
+    for ( w = 0; w < nWords * Gia_ManCiNum(pOld); w++ )
+        pCis[w] = ((word)Gia_ManRandom(0) << 32) | (word)Gia_ManRandom(0);
+    pSimsOld = Gia_RmpSimulate( pOld, pCis, nWords );
+    pSimsNew = Gia_RmpSimulate( pNew, pCis, nWords );
+    // hash the objects of the new AIG by their signatures
+    Vec_MemHashAlloc( vSigs, Gia_ManObjNum(pNew) );
+    Gia_ManForEachObj( pNew, pObj, i )
+    {
+        if ( !Gia_ObjIsAnd(pObj) && !Gia_ObjIsCi(pObj) && i > 0 )
+            continue;
+        Gia_RmpSimNormalize( pSimsNew + nWords * i, pSig, nWords );
+        if ( Vec_MemHashInsert(vSigs, pSig) == Vec_IntSize(vSig2New) )
+            Vec_IntPush( vSig2New, i );
+    }
+    // match the objects of the old AIG
+    Vec_IntWriteEntry( vOld2New, 0, 0 );
+    Gia_ManForEachCi( pOld, pObj, i )
+        Vec_IntWriteEntry( vOld2New, Gia_ObjId(pOld, pObj), Gia_ManCiIdToId(pNew, i) );
+    Gia_ManForEachAnd( pOld, pObj, i )
+    {
+        Gia_RmpSimNormalize( pSimsOld + nWords * i, pSig, nWords );
+        iCopy = Abc_Lit2Var( Gia_ObjValue(pObj) );
+        if ( Gia_ObjValue(pObj) != ~0 && iCopy < Gia_ManObjNum(pNew) )
+        {
+            Gia_RmpSimNormalize( pSimsNew + nWords * iCopy, pTemp, nWords );
+            if ( !memcmp(pSig, pTemp, sizeof(word) * nWords) )
+            {
+                Vec_IntWriteEntry( vOld2New, i, iCopy );
+                continue;
+            }
+        }
+        pSpot = Vec_MemHashLookup( vSigs, pSig );
+        if ( *pSpot != -1 )
+            Vec_IntWriteEntry( vOld2New, i, Vec_IntEntry(vSig2New, *pSpot) );
+    }
+    Vec_MemHashFree( vSigs );
+    Vec_MemFree( vSigs );
+    Vec_IntFree( vSig2New );
+    ABC_FREE( pSimsOld );
+    ABC_FREE( pSimsNew );
+    ABC_FREE( pCis );
+    ABC_FREE( pSig );
+    ABC_FREE( pTemp );
+    return vOld2New;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers mapping of the old AIG into the new AIG.]
+
+  Description [The objects of the two AIGs, which have the same CIs,
+  are matched by Gia_RmpMatchObjects(). The LUTs whose root or leaves
+  are not matched are skipped. The resulting mapping may be incomplete
+  or not valid structurally; it is meant to be repaired by the
+  incremental mapper Gia_ManRemapIncremental(). Returns the number of
+  transferred LUTs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManTransferMappingPartial( Gia_Man_t * pOld, Gia_Man_t * pNew )
+{
+    Vec_Int_t * vOld2New;
+    int i, k, iFan, iRoot, iLeaf, nLuts = 0;
+    Vec_IntFreeP( &pNew->vMapping );
+    pNew->vMapping = Vec_IntAlloc( 2 * Gia_ManObjNum(pNew) );
+    Vec_IntFill( pNew->vMapping, Gia_ManObjNum(pNew), 0 );
+    if ( !Gia_ManHasMapping(pOld) || Gia_ManCiNum(pOld) != Gia_ManCiNum(pNew) )
+        return 0;
+    vOld2New = Gia_RmpMatchObjects( pOld, pNew, 4 );
+    Gia_ManForEachLut( pOld, i )
+    {
+        iRoot = Vec_IntEntry( vOld2New, i );
+        if ( iRoot <= 0 || !Gia_ObjIsAnd(Gia_ManObj(pNew, iRoot)) || Vec_IntEntry(pNew->vMapping, iRoot) )
+            continue;
+        Gia_LutForEachFanin( pOld, i, iFan, k )
+        {
+            iLeaf = Vec_IntEntry( vOld2New, iFan );
+            if ( iLeaf < 0 || iLeaf >= iRoot )
+                break;
+        }
+        if ( k < Gia_ObjLutSize(pOld, i) )
+            continue;
+        Vec_IntWriteEntry( pNew->vMapping, iRoot, Vec_IntSize(pNew->vMapping) );
+        Vec_IntPush( pNew->vMapping, Gia_ObjLutSize(pOld, i) );
+        Gia_LutForEachFanin( pOld, i, iFan, k )
+            Vec_IntPush( pNew->vMapping, Vec_IntEntry(vOld2New, iFan) );
+        Vec_IntPush( pNew->vMapping, iRoot );
+        nLuts++;
+    }
+    Vec_IntFree( vOld2New );
+    return nLuts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the old LUT of the node can be reused.]
+
+  Description [The LUT can be reused if its leaves are distinct nodes
+  with smaller IDs and they cut the node from the CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RmpLutCone_rec( Gia_Man_t * p, int iObj, int * pnNodes )
+{
+    Gia_Obj_t * pObj;
+    if ( iObj == 0 || Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return 1;
+    Gia_ObjSetTravIdCurrentId( p, iObj );
+    pObj = Gia_ManObj( p, iObj );
+    if ( !Gia_ObjIsAnd(pObj) || ++(*pnNodes) > GIA_RMP_CONE_MAX )
+        return 0;
+    return Gia_RmpLutCone_rec( p, Gia_ObjFaninId0(pObj, iObj), pnNodes ) &&
+           Gia_RmpLutCone_rec( p, Gia_ObjFaninId1(pObj, iObj), pnNodes );
+}
+static int Gia_RmpLutIsValid( Gia_Man_t * p, int iObj, int nLutSize )
+{
+    Vec_Int_t * vMap = p->vMapping;
+    int k, iFan, Offset, nSize, nNodes = 0;
+    if ( vMap == NULL || iObj >= Vec_IntSize(vMap) )
+        return 0;
+    Offset = Vec_IntEntry( vMap, iObj );
+    if ( Offset < Gia_ManObjNum(p) || Offset >= Vec_IntSize(vMap) )
+        return 0;
+    nSize = Vec_IntEntry( vMap, Offset );
+    if ( nSize < 1 || nSize > nLutSize || Offset + nSize >= Vec_IntSize(vMap) )
+        return 0;
+    Gia_ManIncrementTravId( p );
+    for ( k = 0; k < nSize; k++ )
+    {
+        iFan = Vec_IntEntry( vMap, Offset + 1 + k );
+        if ( iFan <= 0 || iFan >= iObj || Gia_ObjIsTravIdCurrentId(p, iFan) )
+            return 0;
+        Gia_ObjSetTravIdCurrentId( p, iFan );
+    }
+    return Gia_RmpLutCone_rec( p, iObj, &nNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the LUTs of the old mapping that can be kept.]
+
+  Description [Traverses the old mapping from the COs. The LUT of a
+  used node is kept if it is structurally valid and the node is not in
+  the list of changed nodes. Otherwise, the node is dirty and its fanin
+  cone is traversed until the nodes whose LUTs can be kept, so that the
+  remapped region is bounded by them. Returns the number of dirty nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RmpMarkOldMapping( Gia_RmpMan_t * p, Vec_Int_t * vChanged )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Str_t * vUsed = Vec_StrStart( Gia_ManObjNum(pGia) );
+    Vec_Str_t * vChange = Vec_StrStart( Gia_ManObjNum(pGia) );
+    Gia_Obj_t * pObj;
+    int i, k, iFan, nDirty = 0;
+    if ( vChanged )
+        Vec_IntForEachEntry( vChanged, iFan, i )
+            if ( iFan > 0 && iFan < Gia_ManObjNum(pGia) )
+                Vec_StrWriteEntry( vChange, iFan, 1 );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_StrWriteEntry( vUsed, Gia_ObjFaninId0p(pGia, pObj), 1 );
+    Gia_ManForEachAndReverse( pGia, pObj, i )
+    {
+        if ( !Vec_StrEntry(vUsed, i) )
+            continue;
+        if ( !Vec_StrEntry(vChange, i) && Gia_RmpLutIsValid(pGia, i, p->nLutSize) )
+        {
+            Vec_StrWriteEntry( p->vState, i, GIA_RMP_KEEP );
+            Gia_LutForEachFanin( pGia, i, iFan, k )
+                Vec_StrWriteEntry( vUsed, iFan, 1 );
+            continue;
+        }
+        // the node is used as a LUT root
+        if ( Vec_StrEntry(vUsed, i) == 1 )
+        {
+            Vec_StrWriteEntry( p->vState, i, GIA_RMP_DIRTY );
+            nDirty++;
+        }
+        // the fanins are in the cone of a remapped node
+        if ( !Vec_StrEntry(vUsed, Gia_ObjFaninId0(pObj, i)) )
+            Vec_StrWriteEntry( vUsed, Gia_ObjFaninId0(pObj, i), 2 );
+        if ( !Vec_StrEntry(vUsed, Gia_ObjFaninId1(pObj, i)) )
+            Vec_StrWriteEntry( vUsed, Gia_ObjFaninId1(pObj, i), 2 );
+    }
+    // the changed nodes inside the LUTs are dirty too (their TFO may be reselected)
+    Gia_ManForEachAnd( pGia, pObj, i )
+        if ( Vec_StrEntry(vChange, i) && Vec_StrEntry(p->vState, i) == GIA_RMP_NONE )
+            Vec_StrWriteEntry( p->vState, i, GIA_RMP_DIRTY );
+    Vec_StrFree( vChange );
+    Vec_StrFree( vUsed );
+    return nDirty;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the kept LUTs in the TFO of the dirty nodes.]
+
+  Description [The kept LUTs, whose roots are at most nTfoLevels AIG
+  levels above a dirty node, are reselected together with the dirty
+  nodes. Returns the number of such LUTs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RmpMarkTfo( Gia_RmpMan_t * p, int nTfoLevels )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vDist;
+    Gia_Obj_t * pObj;
+    int i, Dist, Dist0, Dist1, nTfo = 0;
+    if ( nTfoLevels <= 0 )
+        return 0;
+    vDist = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( Vec_StrEntry(p->vState, i) == GIA_RMP_DIRTY )
+        {
+            Vec_IntWriteEntry( vDist, i, 0 );
+            continue;
+        }
+        Dist0 = Vec_IntEntry( vDist, Gia_ObjFaninId0(pObj, i) );
+        Dist1 = Vec_IntEntry( vDist, Gia_ObjFaninId1(pObj, i) );
+        if ( Dist0 == -1 && Dist1 == -1 )
+            continue;
+        Dist = 1 + ((Dist0 == -1 || (Dist1 != -1 && Dist1 < Dist0)) ? Dist1 : Dist0);
+        if ( Dist > nTfoLevels )
+            continue;
+        Vec_IntWriteEntry( vDist, i, Dist );
+        if ( Vec_StrEntry(p->vState, i) == GIA_RMP_KEEP )
+        {
+            Vec_StrWriteEntry( p->vState, i, GIA_RMP_TFO );
+            nTfo++;
+        }
+    }
+    Vec_IntFree( vDist );
+    return nTfo;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes to be remapped.]
+
+  Description [These are the dirty nodes, the nodes in their TFO, and
+  the nodes in their TFI up to the kept LUTs and the CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RmpCollect( Gia_RmpMan_t * p )
+{
+    Vec_Str_t * vMark = Vec_StrStart( Gia_ManObjNum(p->pGia) );
+    Gia_Obj_t * pObj;
+    int i, iObj;
+    // the fanin cones are collected in the reverse topological order
+    Gia_ManForEachAndReverse( p->pGia, pObj, i )
+    {
+        if ( Vec_StrEntry(p->vState, i) == GIA_RMP_KEEP )
+            continue;
+        if ( Vec_StrEntry(p->vState, i) < GIA_RMP_DIRTY && !Vec_StrEntry(vMark, i) )
+            continue;
+        Vec_StrWriteEntry( vMark, Gia_ObjFaninId0(pObj, i), 1 );
+        Vec_StrWriteEntry( vMark, Gia_ObjFaninId1(pObj, i), 1 );
+        Vec_IntPush( p->vNodes, i );
+    }
+    Vec_StrFree( vMark );
+    Vec_IntReverseOrder( p->vNodes );
+    Vec_IntForEachEntry( p->vNodes, iObj, i )
+        Vec_IntWriteEntry( p->vSlot, iObj, i );
+    p->pCuts  = ABC_ALLOC( Gia_RmpCut_t, Vec_IntSize(p->vNodes) * p->nCutNum );
+    p->pnCuts = ABC_CALLOC( int, Vec_IntSize(p->vNodes) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cut manipulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_RmpCutSetTriv( Gia_RmpCut_t * pCut, int iObj )
+{
+    pCut->nLeaves = (iObj > 0);
+    pCut->pLeaves[0] = iObj;
+    pCut->Sign = iObj > 0 ? ((word)1 << (iObj % 63)) : 0;
+}
+static inline int Gia_RmpCutMerge( Gia_RmpCut_t * pCut0, Gia_RmpCut_t * pCut1, Gia_RmpCut_t * pCut, int nLutSize )
+{
+    int i = 0, k = 0, c = 0;
+    if ( Abc_TtCountOnes(pCut0->Sign | pCut1->Sign) > nLutSize )
+        return 0;
+    while ( i < pCut0->nLeaves || k < pCut1->nLeaves )
+    {
+        if ( c == nLutSize )
+            return 0;
+        if ( k == pCut1->nLeaves || (i < pCut0->nLeaves && pCut0->pLeaves[i] < pCut1->pLeaves[k]) )
+            pCut->pLeaves[c++] = pCut0->pLeaves[i++];
+        else if ( i == pCut0->nLeaves || pCut0->pLeaves[i] > pCut1->pLeaves[k] )
+            pCut->pLeaves[c++] = pCut1->pLeaves[k++];
+        else
+            pCut->pLeaves[c++] = pCut0->pLeaves[i++], k++;
+    }
+    pCut->nLeaves = c;
+    pCut->Sign = pCut0->Sign | pCut1->Sign;
+    return 1;
+}
+// returns 1 if the first cut is contained in the second one
+static inline int Gia_RmpCutIsContained( Gia_RmpCut_t * pDom, Gia_RmpCut_t * pCut )
+{
+    int i, k = 0;
+    if ( pDom->nLeaves > pCut->nLeaves || (pDom->Sign & pCut->Sign) != pDom->Sign )
+        return 0;
+    for ( i = 0; i < pDom->nLeaves; i++ )
+    {
+        while ( k < pCut->nLeaves && pCut->pLeaves[k] < pDom->pLeaves[i] )
+            k++;
+        if ( k == pCut->nLeaves || pCut->pLeaves[k] != pDom->pLeaves[i] )
+            return 0;
+    }
+    return 1;
+}
+static inline void Gia_RmpCutEval( Gia_RmpMan_t * p, Gia_RmpCut_t * pCut )
+{
+    int i, iLeaf;
+    pCut->Delay = 0;
+    pCut->Flow  = 1;
+    for ( i = 0; i < pCut->nLeaves; i++ )
+    {
+        iLeaf = pCut->pLeaves[i];
+        pCut->Delay = Abc_MaxInt( pCut->Delay, Vec_IntEntry(p->vArr, iLeaf) );
+        if ( Gia_RmpSlot(p, iLeaf) >= 0 )
+            pCut->Flow += Vec_FltEntry(p->vFlow, iLeaf) / Abc_MaxFloat(1.0, Vec_FltEntry(p->vRefs, iLeaf));
+    }
+    pCut->Delay++;
+}
+static inline int Gia_RmpCutCompare( Gia_RmpMan_t * p, Gia_RmpCut_t * pC0, Gia_RmpCut_t * pC1 )
+{
+    if ( p->fArea )
+    {
+        if ( pC0->Flow < pC1->Flow - 0.005 ) return -1;
+        if ( pC0->Flow > pC1->Flow + 0.005 ) return  1;
+        if ( pC0->Delay != pC1->Delay )      return pC0->Delay < pC1->Delay ? -1 : 1;
+    }
+    else
+    {
+        if ( pC0->Delay != pC1->Delay )      return pC0->Delay < pC1->Delay ? -1 : 1;
+        if ( pC0->Flow < pC1->Flow - 0.005 ) return -1;
+        if ( pC0->Flow > pC1->Flow + 0.005 ) return  1;
+    }
+    if ( pC0->nLeaves != pC1->nLeaves )      return pC0->nLeaves < pC1->nLeaves ? -1 : 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the remapped node.]
+
+  Description [The fanins, which are not remapped, have only the trivial
+  cut. The best cut is in the first place. In the area-flow mode, the
+  best cut of the previous round is added first (similar to the mapper
+  in "map/if"), so that the required time can be met; the cuts not
+  meeting it are skipped, unless none of the cuts meets it, in which
+  case the fastest cut is used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RmpNodeCuts( Gia_RmpMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    Gia_RmpCut_t Triv0, Triv1, * pList0[GIA_RMP_CUT_MAX+1], * pList1[GIA_RMP_CUT_MAX+1];
+    Gia_RmpCut_t * pCut, * pCuts = p->pTemp, Temp, Fast;
+    int iFan0 = Gia_ObjFaninId0(pObj, iObj), iFan1 = Gia_ObjFaninId1(pObj, iObj);
+    int nList0 = 0, nList1 = 0, nCuts = 0, i, k, m, Req = Vec_IntEntry( p->vReq, iObj );
+    // collect the fanin cuts
+    Gia_RmpCutSetTriv( &Triv0, iFan0 );
+    Gia_RmpCutSetTriv( &Triv1, iFan1 );
+    pList0[nList0++] = &Triv0;
+    pList1[nList1++] = &Triv1;
+    if ( Gia_RmpSlot(p, iFan0) >= 0 )
+        for ( i = 0; i < Gia_RmpCutNum(p, iFan0); i++ )
+            pList0[nList0++] = Gia_RmpCuts(p, iFan0) + i;
+    if ( Gia_RmpSlot(p, iFan1) >= 0 )
+        for ( i = 0; i < Gia_RmpCutNum(p, iFan1); i++ )
+            pList1[nList1++] = Gia_RmpCuts(p, iFan1) + i;
+    // merge the cuts and keep the best ones
+    Fast.Delay = ABC_INFINITY;
+    for ( i = -1; i < nList0; i++ )
+    for ( k = 0; k < nList1; k++ )
+    {
+        pCut = pCuts + nCuts;
+        if ( i == -1 )
+        {
+            // the best cut of the previous round
+            if ( !p->fArea || k > 0 || Gia_RmpCutNum(p, iObj) == 0 )
+                continue;
+            *pCut = *Gia_RmpCuts(p, iObj);
+        }
+        else if ( !Gia_RmpCutMerge(pList0[i], pList1[k], pCut, p->nLutSize) )
+            continue;
+        for ( m = 0; m < nCuts; m++ )
+            if ( Gia_RmpCutIsContained(pCuts + m, pCut) )
+                break;
+        if ( m < nCuts )
+            continue;
+        // remove the cuts dominated by the new one
+        for ( m = 0; m < nCuts; m++ )
+            if ( Gia_RmpCutIsContained(pCut, pCuts + m) )
+            {
+                memmove( pCuts + m, pCuts + m + 1, sizeof(Gia_RmpCut_t) * (nCuts - m) );
+                pCut = pCuts + --nCuts;
+                m--;
+            }
+        Gia_RmpCutEval( p, pCut );
+        if ( p->fArea && pCut->Delay > Req )
+        {
+            if ( Fast.Delay > pCut->Delay )
+                Fast = *pCut;
+            continue;
+        }
+        // insert the new cut into the sorted list
+        for ( m = nCuts; m > 0 && Gia_RmpCutCompare(p, pCuts + m - 1, pCut) > 0; m-- );
+        Temp = *pCut;
+        memmove( pCuts + m + 1, pCuts + m, sizeof(Gia_RmpCut_t) * (nCuts - m) );
+        pCuts[m] = Temp;
+        nCuts = Abc_MinInt( nCuts + 1, p->nCutNum );
+    }
+    if ( nCuts == 0 )
+        pCuts[nCuts++] = Fast;
+    assert( nCuts > 0 );
+    Vec_IntWriteEntry( p->vArr, iObj, pCuts[0].Delay );
+    Vec_FltWriteEntry( p->vFlow, iObj, pCuts[0].Flow );
+    memcpy( Gia_RmpCuts(p, iObj), pCuts, sizeof(Gia_RmpCut_t) * nCuts );
+    p->pnCuts[Gia_RmpSlot(p, iObj)] = nCuts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the leaves of the LUT currently selected for the node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Gia_RmpNodeLeaves( Gia_RmpMan_t * p, int iObj, int * pnLeaves )
+{
+    if ( Gia_RmpSlot(p, iObj) >= 0 )
+    {
+        *pnLeaves = Gia_RmpCuts(p, iObj)->nLeaves;
+        return Gia_RmpCuts(p, iObj)->pLeaves;
+    }
+    assert( Vec_StrEntry(p->vState, iObj) == GIA_RMP_KEEP );
+    *pnLeaves = Gia_ObjLutSize( p->pGia, iObj );
+    return Gia_ObjLutFanins( p->pGia, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of cut selection.]
+
+  Description [Computes the arrival times of the kept LUTs and the cuts
+  of the remapped nodes in one topological pass.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RmpPerformRound( Gia_RmpMan_t * p, int fArea )
+{
+    Gia_Obj_t * pObj;
+    int i, k, nLeaves, * pLeaves, Delay;
+    p->fArea = fArea;
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        if ( Gia_RmpSlot(p, i) >= 0 )
+            Gia_RmpNodeCuts( p, i );
+        else if ( Vec_StrEntry(p->vState, i) == GIA_RMP_KEEP )
+        {
+            pLeaves = Gia_RmpNodeLeaves( p, i, &nLeaves );
+            for ( Delay = k = 0; k < nLeaves; k++ )
+                Delay = Abc_MaxInt( Delay, Vec_IntEntry(p->vArr, pLeaves[k]) );
+            Vec_IntWriteEntry( p->vArr, i, Delay + 1 );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes required times and references of the current mapping.]
+
+  Description [The nodes not used in the mapping have infinite required
+  time. Returns the delay of the mapping.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RmpComputeRequired( Gia_RmpMan_t * p, int fUpdateRefs )
+{
+    Gia_Obj_t * pObj;
+    int i, k, nLeaves, * pLeaves, Req, Delay = 0;
+    Vec_IntFill( p->vReq, Gia_ManObjNum(p->pGia), ABC_INFINITY );
+    Vec_IntFill( p->vMapRefs, Gia_ManObjNum(p->pGia), 0 );
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        Delay = Abc_MaxInt( Delay, Vec_IntEntry(p->vArr, Gia_ObjFaninId0p(p->pGia, pObj)) );
+    Gia_ManForEachCo( p->pGia, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vReq, Gia_ObjFaninId0p(p->pGia, pObj), Delay );
+        Vec_IntAddToEntry( p->vMapRefs, Gia_ObjFaninId0p(p->pGia, pObj), 1 );
+    }
+    Gia_ManForEachAndReverse( p->pGia, pObj, i )
+    {
+        if ( !Vec_IntEntry(p->vMapRefs, i) )
+            continue;
+        Req = Vec_IntEntry( p->vReq, i ) - 1;
+        pLeaves = Gia_RmpNodeLeaves( p, i, &nLeaves );
+        for ( k = 0; k < nLeaves; k++ )
+        {
+            Vec_IntWriteEntry( p->vReq, pLeaves[k], Abc_MinInt(Req, Vec_IntEntry(p->vReq, pLeaves[k])) );
+            Vec_IntAddToEntry( p->vMapRefs, pLeaves[k], 1 );
+        }
+    }
+    if ( fUpdateRefs )
+    {
+        Gia_ManForEachAnd( p->pGia, pObj, i )
+            Vec_FltWriteEntry( p->vRefs, i, (Vec_FltEntry(p->vRefs, i) + 2.0 * Vec_IntEntry(p->vMapRefs, i)) / 3.0 );
+    }
+    return Delay;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the new mapping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Gia_RmpDeriveMapping( Gia_RmpMan_t * p )
+{
+    Vec_Int_t * vMapping;
+    Gia_Obj_t * pObj;
+    int i, k, nLeaves, * pLeaves;
+    Gia_RmpComputeRequired( p, 0 );
+    vMapping = Vec_IntAlloc( 2 * Gia_ManObjNum(p->pGia) );
+    Vec_IntFill( vMapping, Gia_ManObjNum(p->pGia), 0 );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        if ( !Vec_IntEntry(p->vMapRefs, i) )
+            continue;
+        pLeaves = Gia_RmpNodeLeaves( p, i, &nLeaves );
+        Vec_IntWriteEntry( vMapping, i, Vec_IntSize(vMapping) );
+        Vec_IntPush( vMapping, nLeaves );
+        for ( k = 0; k < nLeaves; k++ )
+            Vec_IntPush( vMapping, pLeaves[k] );
+        Vec_IntPush( vMapping, i );
+    }
+    return vMapping;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incrementally remaps the AIG after local changes.]
+
+  Description [Takes the AIG with the mapping (p->vMapping), which may
+  be incomplete or structurally invalid in some places, and the array of
+  changed nodes (vChanged, may be NULL). The LUTs of the old mapping are
+  kept, unless their roots are changed, their cones are not bounded by
+  their leaves, or their roots are at most nTfoLevels AIG levels above
+  such nodes. The other used nodes and their fanin cones up to the kept
+  LUTs are remapped with priority cuts: one round of delay-oriented cut
+  selection is followed by two rounds of area-flow recovery under the
+  required times. Only the remapped nodes are enumerated; the kept LUTs
+  are only visited to update their arrival times. If the AIG has no
+  mapping, it is mapped from scratch. If nRemapMax is not 0 and more
+  than nRemapMax nodes should be remapped, the mapping is not changed
+  (the caller may map the AIG by the full mapper). Returns the number of
+  nodes to remap or -1 if the AIG cannot be remapped.]
+
+  SideEffects [Replaces p->vMapping.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManRemapIncremental( Gia_Man_t * p, Vec_Int_t * vChanged, int nLutSize, int nCutNum, int nTfoLevels, int nRemapMax, int fVerbose )
+{
+    extern void Gia_ManMappingVerify( Gia_Man_t * p );
+    Gia_RmpMan_t * pMan;
+    Vec_Int_t * vMapping;
+    Gia_Obj_t * pObj;
+    int i, nLutsOld = 0, nRemapped, Delay;
+    abctime clk = Abc_Clock();
+    if ( nLutSize < 2 || nLutSize > GIA_RMP_LEAF_MAX || nCutNum < 1 || nCutNum > GIA_RMP_CUT_MAX )
+    {
+        Abc_Print( -1, "Gia_ManRemapIncremental(): The LUT size (%d) should be from 2 to %d and the cut number (%d) from 1 to %d.\n",
+            nLutSize, GIA_RMP_LEAF_MAX, nCutNum, GIA_RMP_CUT_MAX );
+        return -1;
+    }
+    if ( p->pManTime || Gia_ManHasChoices(p) )
+    {
+        Abc_Print( -1, "Gia_ManRemapIncremental(): AIGs with boxes or choices are not supported.\n" );
+        return -1;
+    }
+    if ( Gia_ManHasMapping(p) && Vec_IntSize(p->vMapping) >= Gia_ManObjNum(p) )
+        nLutsOld = Gia_ManLutNum( p );
+    // start the manager
+    pMan = ABC_CALLOC( Gia_RmpMan_t, 1 );
+    pMan->pGia     = p;
+    pMan->nLutSize = nLutSize;
+    pMan->nCutNum  = nCutNum;
+    pMan->vState   = Vec_StrStart( Gia_ManObjNum(p) );
+    pMan->vSlot    = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pMan->vNodes   = Vec_IntAlloc( 1000 );
+    pMan->vArr     = Vec_IntStart( Gia_ManObjNum(p) );
+    pMan->vReq     = Vec_IntStart( Gia_ManObjNum(p) );
+    pMan->vFlow    = Vec_FltStart( Gia_ManObjNum(p) );
+    pMan->vRefs    = Vec_FltStart( Gia_ManObjNum(p) );
+    pMan->vMapRefs = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_IntFill( pMan->vReq, Gia_ManObjNum(p), ABC_INFINITY );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Vec_FltAddToEntry( pMan->vRefs, Gia_ObjFaninId0(pObj, i), 1.0 );
+        Vec_FltAddToEntry( pMan->vRefs, Gia_ObjFaninId1(pObj, i), 1.0 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_FltAddToEntry( pMan->vRefs, Gia_ObjFaninId0p(p, pObj), 1.0 );
+    // find the nodes to remap
+    pMan->nDirty = Gia_RmpMarkOldMapping( pMan, vChanged );
+    pMan->nTfo   = Gia_RmpMarkTfo( pMan, nTfoLevels );
+    Gia_RmpCollect( pMan );
+    nRemapped = Vec_IntSize( pMan->vNodes );
+    if ( nRemapMax > 0 && nRemapped > nRemapMax )
+    {
+        if ( fVerbose )
+            printf( "Dirty = %d.  TFO = %d.  The number of nodes to remap (%d) exceeds the limit (%d).\n",
+                pMan->nDirty, pMan->nTfo, nRemapped, nRemapMax );
+        goto finish;
+    }
+    // select the cuts
+    Gia_RmpPerformRound( pMan, 0 );
+    Delay = Gia_RmpComputeRequired( pMan, 1 );
+    Gia_RmpPerformRound( pMan, 1 );
+    Gia_RmpComputeRequired( pMan, 1 );
+    Gia_RmpPerformRound( pMan, 1 );
+    // update the mapping
+    vMapping = Gia_RmpDeriveMapping( pMan );
+    Vec_IntFreeP( &p->vMapping );
+    p->vMapping = vMapping;
+    Gia_ManMappingVerify( p );
+    if ( fVerbose )
+    {
+        printf( "Dirty = %d.  TFO = %d.  Remapped = %d (%.2f %%).  ",
+            pMan->nDirty, pMan->nTfo, nRemapped, 100.0 * nRemapped / Abc_MaxInt(1, Gia_ManAndNum(p)) );
+        printf( "LUTs: %d -> %d.  Delay = %d.  ", nLutsOld, Gia_ManLutNum(p), Delay );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+finish:
+    // stop the manager
+    Vec_StrFree( pMan->vState );
+    Vec_IntFree( pMan->vSlot );
+    Vec_IntFree( pMan->vNodes );
+    Vec_IntFree( pMan->vArr );
+    Vec_IntFree( pMan->vReq );
+    Vec_FltFree( pMan->vFlow );
+    Vec_FltFree( pMan->vRefs );
+    Vec_IntFree( pMan->vMapRefs );
+    ABC_FREE( pMan->pCuts );
+    ABC_FREE( pMan->pnCuts );
+    ABC_FREE( pMan );
+    return nRemapped;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -217,25 +218,7 @@ static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
     unsigned * pInfo1 = Gia_Sim2Data( p, Gia_ObjFaninId1(pObj, Gia_ObjValue(pObj)) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    Abc_SimdAnd( pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj) ? ~0 : 0, Gia_ObjFaninC1(pObj) ? ~0 : 0, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -306,21 +289,7 @@ static inline void Gia_Sim2SimulateRound( Gia_Sim2_t * p )
 ***********************************************************************/
 int Gia_Sim2CompareEqual( unsigned * p0, unsigned * p1, int nWords, int fCompl )
 {
-    int w;
-    if ( !fCompl )
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != p1[w] )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != ~p1[w] )
-                return 0;
-        return 1;
-    }
+    return Abc_SimdIsEqual( p0, p1, fCompl ? ~0 : 0, nWords );
 }
 
 /**Function*************************************************************
@@ -0,0 +1,349 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded bit-parallel simulator.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSimPth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the range of simulation words processed by one thread
+typedef struct Gia_SimPthData_t_ Gia_SimPthData_t;
+struct Gia_SimPthData_t_
+{
+    int *          pFans;        // fanin literals of all objects
+    int            nObjs;        // the number of objects
+    word *         pSims;        // simulation info of all objects
+    int            nStride;      // the distance between the objects
+    int            iStart;       // the first word
+    int            iStop;        // the word after the last one
+};
+
+static inline word * Gia_SimPthObj( word * pSims, int nStride, int Id ) { return pSims + (size_t)Id * nStride; }
+static inline word   Gia_SimPthRandom()                                 { return ((word)Gia_ManRandom(0) << 32) | (word)Gia_ManRandom(0); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the range of words for all objects.]
+
+  Description [Assumes that the simulation info of the CIs is given.
+  Uses the structure-of-arrays view of the fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateWordsRange( int * pFans, int nObjs, word * pSims, int nStride, int iStart, int iStop )
+{
+    word * pSim, * pSim0, * pSim1;
+    int i, w;
+    pSim = Gia_SimPthObj( pSims, nStride, 0 );
+    for ( w = iStart; w < iStop; w++ )
+        pSim[w] = 0;
+    for ( i = 1; i < nObjs; i++ )
+    {
+        if ( Gia_SoaIsCi(pFans, i) )
+            continue;
+        pSim  = Gia_SimPthObj( pSims, nStride, i );
+        pSim0 = Gia_SimPthObj( pSims, nStride, Gia_SoaFanId0(pFans, i) );
+        if ( Gia_SoaIsCo(pFans, i) )
+        {
+            if ( Gia_SoaFanC0(pFans, i) )
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = ~pSim0[w];
+            else
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = pSim0[w];
+            continue;
+        }
+        pSim1 = Gia_SimPthObj( pSims, nStride, Gia_SoaFanId1(pFans, i) );
+        if ( Gia_SoaFanC0(pFans, i) )
+        {
+            if ( Gia_SoaFanC1(pFans, i) )
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = ~(pSim0[w] | pSim1[w]);
+            else
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = ~pSim0[w] & pSim1[w];
+        }
+        else
+        {
+            if ( Gia_SoaFanC1(pFans, i) )
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = pSim0[w] & ~pSim1[w];
+            else
+                for ( w = iStart; w < iStop; w++ )
+                    pSim[w] = pSim0[w] & pSim1[w];
+        }
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Simulation thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManSimulateWordsThread( void * pArg )
+{
+    Gia_SimPthData_t * pData = (Gia_SimPthData_t *)pArg;
+    Gia_ManSimulateWordsRange( pData->pFans, pData->nObjs, pData->pSims, pData->nStride, pData->iStart, pData->iStop );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AIG using several threads.]
+
+  Description [The simulation info of object Id occupies nWords words
+  starting from pSims + Id * nStride. The info of the CIs should be
+  given. The words are divided into contiguous ranges, one for each
+  thread, and each thread simulates all objects on its range. This way,
+  the threads never wait for each other and never write into the same
+  words. The ranges are aligned to cache lines when possible.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateWordsMt( Gia_Man_t * p, word * pSims, int nStride, int nWords, int nThreads )
+{
+    int * pFans = Gia_ManSoaFans( p );
+#ifdef ABC_USE_PTHREADS
+    Gia_SimPthData_t * pData;
+    pthread_t * pThreads;
+    int i, nChunk, status;
+    nThreads = Abc_MinInt( nThreads, nWords );
+    if ( nThreads > 1 )
+    {
+        nChunk = (nWords + nThreads - 1) / nThreads;
+        if ( nChunk > 8 )
+            nChunk = 8 * ((nChunk + 7) / 8);
+        nThreads = (nWords + nChunk - 1) / nChunk;
+    }
+    if ( nThreads > 1 )
+    {
+        pData    = ABC_CALLOC( Gia_SimPthData_t, nThreads );
+        pThreads = ABC_ALLOC( pthread_t, nThreads );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pData[i].pFans   = pFans;
+            pData[i].nObjs   = Gia_ManObjNum(p);
+            pData[i].pSims   = pSims;
+            pData[i].nStride = nStride;
+            pData[i].iStart  = i * nChunk;
+            pData[i].iStop   = Abc_MinInt( (i + 1) * nChunk, nWords );
+            status = pthread_create( pThreads + i, NULL, Gia_ManSimulateWordsThread, (void *)(pData + i) );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( pThreads[i], NULL );
+            assert( status == 0 );
+        }
+        ABC_FREE( pThreads );
+        ABC_FREE( pData );
+        return;
+    }
+#endif // pthreads are used
+    Gia_ManSimulateWordsRange( pFans, Gia_ManObjNum(p), pSims, nStride, 0, nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns random patterns to the PIs and the state to the ROs.]
+
+  Description [The initial state is all zeros. The next states are taken
+  from the RIs computed in the previous frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimPthInfoInit( Gia_Man_t * p, word * pSims, int nWords, int iFrame )
+{
+    Gia_Obj_t * pObj, * pObjRi;
+    word * pSim;
+    int i, w;
+    Gia_ManForEachPi( p, pObj, i )
+    {
+        pSim = Gia_SimPthObj( pSims, nWords, Gia_ObjId(p, pObj) );
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = Gia_SimPthRandom();
+    }
+    Gia_ManForEachRiRo( p, pObjRi, pObj, i )
+    {
+        pSim = Gia_SimPthObj( pSims, nWords, Gia_ObjId(p, pObj) );
+        if ( iFrame == 0 )
+            memset( pSim, 0, sizeof(word) * nWords );
+        else
+            memcpy( pSim, Gia_SimPthObj(pSims, nWords, Gia_ObjId(p, pObjRi)), sizeof(word) * nWords );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the counter-example.]
+
+  Description [Regenerates the random patterns of the PIs in the same
+  order in which they were generated during simulation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_ManSimPthGenerateCex( Gia_Man_t * p, Gia_ParSim_t * pPars, int iFrame, int iOut, int nWords, int iPat )
+{
+    Abc_Cex_t * pCex;
+    word Data;
+    int f, i, w;
+    pCex = Abc_CexAlloc( Gia_ManRegNum(p), Gia_ManPiNum(p), iFrame+1 );
+    pCex->iFrame = iFrame;
+    pCex->iPo    = iOut;
+    Gia_ManResetRandom( pPars );
+    for ( f = 0; f <= iFrame; f++ )
+    for ( i = 0; i < Gia_ManPiNum(p); i++ )
+    for ( w = 0; w < nWords; w++ )
+    {
+        Data = Gia_SimPthRandom();
+        if ( w == iPat / 64 && ((Data >> (iPat % 64)) & 1) )
+            Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + i );
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs random sequential simulation using several threads.]
+
+  Description [Uses 64-bit words. The flat simulation info of all objects
+  is kept, which takes more memory than the frontier-based simulator.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSimulateMt( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_Obj_t * pObj;
+    word * pSims, * pSim;
+    abctime clkTotal = Abc_Clock();
+    time_t Deadline = pPars->TimeLimit ? time(NULL) + pPars->TimeLimit : 0;
+    int i, k, w, nWords = pPars->nWords, iOut = -1, iPat = -1, RetValue = 0;
+    ABC_FREE( pAig->pCexSeq );
+    pSims = ABC_ALLOC( word, (size_t)nWords * Gia_ManObjNum(pAig) );
+    if ( pSims == NULL )
+    {
+        Abc_Print( 1, "Simulator could not allocate %.2f GB for simulation info.\n", 8.0 * nWords * Gia_ManObjNum(pAig) / (1<<30) );
+        return 0;
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Simulating %d frames with %d words using %d threads. Sim mem = %.2f MB.\n",
+            pPars->nIters, nWords, pPars->nThreads, 8.0 * nWords * Gia_ManObjNum(pAig) / (1<<20) );
+    Gia_ManResetRandom( pPars );
+    for ( i = 0; i < pPars->nIters; i++ )
+    {
+        Gia_ManSimPthInfoInit( pAig, pSims, nWords, i );
+        Gia_ManSimulateWordsMt( pAig, pSims, nWords, nWords, pPars->nThreads );
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
+        }
+        if ( pPars->fCheckMiter )
+        {
+            Gia_ManForEachPo( pAig, pObj, k )
+            {
+                pSim = Gia_SimPthObj( pSims, nWords, Gia_ObjId(pAig, pObj) );
+                for ( w = 0; w < nWords; w++ )
+                    if ( pSim[w] )
+                        break;
+                if ( w == nWords )
+                    continue;
+                iOut = k;
+                iPat = 64 * w + Abc_Tt6FirstBit( pSim[w] );
+                break;
+            }
+        }
+        if ( iOut >= 0 )
+        {
+            pPars->iOutFail = iOut;
+            pAig->pCexSeq = Gia_ManSimPthGenerateCex( pAig, pPars, i, iOut, nWords, iPat );
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", iOut, pAig->pName, i );
+            if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+                Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+            RetValue = 1;
+            break;
+        }
+        if ( Deadline && time(NULL) >= Deadline )
+        {
+            i++;
+            break;
+        }
+    }
+    ABC_FREE( pSims );
+    if ( pAig->pCexSeq == NULL )
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,125 @@
+/**CFile****************************************************************
+
+  FileName    [giaSoa.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structure-of-arrays view of the AIG.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSoa.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Brings the fanin view up to date.]
+
+  Description [The fanin literals of the objects are stored in a separate
+  array, two integers per object, so that structural passes do not load
+  the marks and values of the objects and do not decode the bit-fields.
+  Only the objects appended after the last update are added. Procedures
+  modifying the fanins in place should call Gia_ManSoaInvalidate().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaUpdate( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    if ( p->vSoaFans == NULL )
+        p->vSoaFans = Vec_IntAlloc( 2 * p->nObjsAlloc );
+    if ( p->nSoaObjs > p->nObjs )
+        p->nSoaObjs = p->nObjs;
+    Vec_IntShrink( p->vSoaFans, 2 * p->nSoaObjs );
+    for ( i = p->nSoaObjs; i < p->nObjs; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Vec_IntPush( p->vSoaFans, Gia_ObjFaninLit0(pObj, i) );
+            Vec_IntPush( p->vSoaFans, Gia_ObjFaninLit1(pObj, i) );
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            Vec_IntPush( p->vSoaFans, Gia_ObjFaninLit0(pObj, i) );
+            Vec_IntPush( p->vSoaFans, -1 );
+        }
+        else
+        {
+            Vec_IntPush( p->vSoaFans, -1 );
+            Vec_IntPush( p->vSoaFans, -1 );
+        }
+    }
+    p->nSoaObjs = p->nObjs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes levels using the fanin view.]
+
+  Description [Does not support MUXes. XORs are recognized by the order
+  of the fanins, as in Gia_ObjIsXor(). The levels are the same as those
+  computed by Gia_ManLevelNum(), which does not call this procedure;
+  it is called by the user who has already built the fanin view.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSoaLevelNum( Gia_Man_t * p )
+{
+    int * pFans = Gia_ManSoaFans( p );
+    int * pLevels, i, Id0, Id1;
+    assert( p->pMuxes == NULL );
+    Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
+    pLevels = Vec_IntArray( p->vLevels );
+    p->nLevels = 0;
+    for ( i = 1; i < p->nObjs; i++ )
+    {
+        if ( Gia_SoaIsCi(pFans, i) )
+            continue;
+        Id0 = Gia_SoaFanId0( pFans, i );
+        if ( Gia_SoaIsCo(pFans, i) )
+        {
+            pLevels[i] = pLevels[Id0];
+            continue;
+        }
+        Id1 = Gia_SoaFanId1( pFans, i );
+        pLevels[i] = Abc_MaxInt( pLevels[Id0], pLevels[Id1] ) + (Id0 > Id1 ? 2 : 1);
+        p->nLevels = Abc_MaxInt( p->nLevels, pLevels[i] );
+    }
+    return p->nLevels;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
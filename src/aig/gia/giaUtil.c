@@ -1377,6 +1377,7 @@ void Gia_ManInvertConstraints( Gia_Man_t * pAig )
     Gia_ManForEachPo( pAig, pObj, i )
         if ( i >= Gia_ManPoNum(pAig) - Gia_ManConstrNum(pAig) )
             Gia_ObjFlipFaninC0( pObj );
+    Gia_ManSoaInvalidate( pAig );
 }
 void Gia_ManInvertPos( Gia_Man_t * pAig )
 {
@@ -1384,6 +1385,7 @@ void Gia_ManInvertPos( Gia_Man_t * pAig )
     int i;
     Gia_ManForEachPo( pAig, pObj, i )
         Gia_ObjFlipFaninC0( pObj );
+    Gia_ManSoaInvalidate( pAig );
 }
 
 /**Function*************************************************************
@@ -42,6 +42,7 @@
 #include "map/amap/amap.h"
 #include "opt/ret/retInt.h"
 #include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
 #include "proof/cec/cec.h"
 #include "proof/pdr/pdr.h"
 #include "misc/tim/tim.h"
@@ -382,6 +383,7 @@ static int Abc_CommandAbc9Jf                 ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Struct             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Trace              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Speedup            ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Remap              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Era                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Dch                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Rpm                ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -400,6 +402,7 @@ static int Abc_CommandAbc9Slice              ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9PoPart             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9GroupProve         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9MultiProve         ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9PortProve          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Bmc                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SatTest            ( Abc_Frame_t * pAbc, int argc, char ** argv );
 //static int Abc_CommandAbc9PoPart2            ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -946,6 +949,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&struct",       Abc_CommandAbc9Struct,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&trace",        Abc_CommandAbc9Trace,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&speedup",      Abc_CommandAbc9Speedup,      0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&remap",        Abc_CommandAbc9Remap,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&era",          Abc_CommandAbc9Era,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&dch",          Abc_CommandAbc9Dch,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&rpm",          Abc_CommandAbc9Rpm,          0 );
@@ -964,6 +968,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&popart",       Abc_CommandAbc9PoPart,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&gprove",       Abc_CommandAbc9GroupProve,   0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&mprove",       Abc_CommandAbc9MultiProve,   0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&pprove",       Abc_CommandAbc9PortProve,    0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bmc",          Abc_CommandAbc9Bmc,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sattest",      Abc_CommandAbc9SatTest,      0 );
 //    Cmd_CommandAdd( pAbc, "ABC9",         "&popart2",      Abc_CommandAbc9PoPart2,      0 );
@@ -10138,11 +10143,12 @@ int Abc_CommandTest( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nDecMax      =  3;
     int fNewAlgo     =  0;
     int fNewOrder    =  0;
+    int fSatTest     =  0;
     int fVerbose     =  0;
     int fVeryVerbose =  0;
     int c;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CKDNaovwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CKDNaosvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -10196,6 +10202,9 @@ int Abc_CommandTest( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'o':
             fNewOrder ^= 1;
             break;
+        case 's':
+            fSatTest ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -10259,13 +10268,18 @@ int Abc_CommandTest( Abc_Frame_t * pAbc, int argc, char ** argv )
 */
 //    if ( pNtk )
 //        Abc_NtkMakeLegit( pNtk ); 
+    if ( fSatTest )
+    {
+        extern int Sat_SolverRollbackTest();
+        return !Sat_SolverRollbackTest();
+    }
     {
         extern void Ifd_ManDsdTest();
         Ifd_ManDsdTest();
     }
     return 0;
 usage:
-    Abc_Print( -2, "usage: test [-CKDN] [-aovwh] <file_name>\n" );
+    Abc_Print( -2, "usage: test [-CKDN] [-aosvwh] <file_name>\n" );
     Abc_Print( -2, "\t         testbench for new procedures\n" );
     Abc_Print( -2, "\t-C num : the max number of cuts [default = %d]\n", nCutMax );
     Abc_Print( -2, "\t-K num : the max number of leaves [default = %d]\n", nLeafMax );
@@ -10273,6 +10287,7 @@ usage:
     Abc_Print( -2, "\t-N num : the max number of node inputs [default = %d]\n", nDecMax );
     Abc_Print( -2, "\t-a     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes": "no" );
     Abc_Print( -2, "\t-o     : toggle using new ordering [default = %s]\n", fNewOrder? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle running the SAT solver rollback test [default = %s]\n", fSatTest? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing very verbose information [default = %s]\n", fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -15422,6 +15437,7 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nCutsMax    =  8;
     pPars->nFlowIters  =  1;
     pPars->nAreaIters  =  2;
+    pPars->nProcs      =  1;
     pPars->DelayTarget = -1;
     pPars->Epsilon     =  (float)0.005;
     pPars->fPreprocess =  1;
@@ -15448,7 +15464,7 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
 
     fLutMux = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGNDEWSTqaflepmrsdbugyojiknvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGNDEWSTPZqaflepmrsdbugyojiknvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -15567,6 +15583,15 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'Z':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Z\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pFuncCache = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -15578,6 +15603,17 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nStructType < 0 || pPars->nStructType > 2 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'q':
             pPars->fPreprocess ^= 1;
             break;
@@ -15895,7 +15931,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: if [-KCFANGT num] [-DEW float] [-S str] [-qarlepmsdbugyojikcnvh]\n" );
+    Abc_Print( -2, "usage: if [-KCFANGTP num] [-DEW float] [-S str] [-Z file] [-qarlepmsdbugyojikcnvh]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -15907,7 +15943,9 @@ usage:
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
     Abc_Print( -2, "\t-S str   : string representing the LUT structure [default = %s]\n", pPars->pLutStruct ? pPars->pLutStruct : "not used" );
+    Abc_Print( -2, "\t-Z file  : file keeping the results of LUT structure checks across runs [default = %s]\n", pPars->pFuncCache ? pPars->pFuncCache : "not used" );
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n", pPars->nStructType );
+    Abc_Print( -2, "\t-P num   : the number of threads for delay and area flow mapping [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-q       : toggles preprocessing using several starting points [default = %s]\n", pPars->fPreprocess? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fArea? "yes": "no" );
 //    Abc_Print( -2, "\t-f       : toggles one fancy feature [default = %s]\n", pPars->fFancy? "yes": "no" );
@@ -19811,7 +19849,7 @@ int Abc_CommandDCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fPartition;
     int fMiter;
 
-    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose );
+    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fSimplify, int nProcs, int fVerbose, void * pTele );
     extern int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPartition, int fVerbose );
 
     pNtk = Abc_FrameReadNtk(pAbc);
@@ -19916,7 +19954,7 @@ int Abc_CommandDCec( Abc_Frame_t * pAbc, int argc, char ** argv )
 
     // perform equivalence checking
     if ( fSat && fMiter )
-        Abc_NtkDSat( pNtk1, nConfLimit, nInsLimit, 0, 0, 0, 0, 0, 0, fVerbose );
+        Abc_NtkDSat( pNtk1, nConfLimit, nInsLimit, 0, 0, 0, 0, 0, 0, 0, 1, fVerbose, NULL );
     else
         Abc_NtkDarCec( pNtk1, pNtk2, nConfLimit, fPartition, fVerbose );
 
@@ -20829,19 +20867,25 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fAlignPol;
     int fAndOuts;
     int fNewSolver;
+    int fSimplify;
+    int nProcs;
     int fVerbose;
     int nConfLimit;
     int nLearnedStart;
     int nLearnedDelta;
     int nLearnedPerce;
     int nInsLimit;
+    char * pTeleFile = NULL;
+    Sat_Tele_t * pTele = NULL;
     abctime clk;
 
-    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose );
+    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fSimplify, int nProcs, int fVerbose, void * pTele );
     // set defaults
     fAlignPol  = 0;
     fAndOuts   = 0;
     fNewSolver = 0;
+    fSimplify  = 0;
+    nProcs     = 1;
     fVerbose   = 0;
     nConfLimit = 0;
     nInsLimit  = 0;
@@ -20849,10 +20893,21 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     nLearnedDelta = 0;
     nLearnedPerce = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEpanvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEPYpansvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'C':
             if ( globalUtilOptind >= argc )
             {
@@ -20908,6 +20963,15 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'Y':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Y\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pTeleFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'p':
             fAlignPol ^= 1;
             break;
@@ -20917,6 +20981,9 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'n':
             fNewSolver ^= 1;
             break;
+        case 's':
+            fSimplify ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -20950,8 +21017,23 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     }
 
+    if ( nProcs > 1 && (fAndOuts || fNewSolver) )
+    {
+        Abc_Print( -1, "The portfolio of solvers (-P) cannot be combined with ANDing of miter outputs (-a) or the new solver (-n).\n" );
+        return 0;
+    }
+
     clk = Abc_Clock();
-    RetValue = Abc_NtkDSat( pNtk, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fVerbose );
+    if ( pTeleFile )
+        pTele = ABC_CALLOC( Sat_Tele_t, 1 );
+    RetValue = Abc_NtkDSat( pNtk, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fSimplify, nProcs, fVerbose, pTele );
+    if ( pTele )
+    {
+        if ( fVerbose )
+            Sat_TelePrint( stdout, pTele );
+        Sat_TeleDumpJson( pTele, pTeleFile, "dsat" );
+        ABC_FREE( pTele );
+    }
     // verify that the pattern is correct
     if ( RetValue == 0 && Abc_NtkPoNum(pNtk) == 1 )
     {
@@ -20973,7 +21055,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dsat [-CILDE num] [-panvh]\n" );
+    Abc_Print( -2, "usage: dsat [-CILDEP num] [-Y file] [-pansvh]\n" );
     Abc_Print( -2, "\t         solves the combinational miter using SAT solver MiniSat-1.14\n" );
     Abc_Print( -2, "\t         derives CNF from the current network and leave it unchanged\n" );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
@@ -20981,9 +21063,12 @@ usage:
     Abc_Print( -2, "\t-L num : starting value for learned clause removal [default = %d]\n", nLearnedStart );
     Abc_Print( -2, "\t-D num : delta value for learned clause removal [default = %d]\n", nLearnedDelta );
     Abc_Print( -2, "\t-E num : ratio percentage for learned clause removal [default = %d]\n", nLearnedPerce );
+    Abc_Print( -2, "\t-P num : the number of diversified solvers sharing clauses (not with -a or -n) [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-Y file: the file name for SAT solver telemetry in JSON [default = %s]\n", pTeleFile ? pTeleFile : "not used" );
     Abc_Print( -2, "\t-p     : alighn polarity of SAT variables [default = %s]\n", fAlignPol? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle ANDing/ORing of miter outputs [default = %s]\n", fAndOuts? "ANDing": "ORing" );
     Abc_Print( -2, "\t-n     : toggle using new solver [default = %s]\n", fNewSolver? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle CNF simplification (BVE, subsumption, probing) [default = %s]\n", fSimplify? "yes": "no" );
     Abc_Print( -2, "\t-v     : prints verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -21756,11 +21841,12 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     Vec_Ptr_t * vSeqModelVec = NULL;
     Vec_Int_t * vStatuses = NULL;
     char * pLogFileName = NULL;
+    char * pTeleFile = NULL;
     int fOrDecomp = 0;
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLaxdruvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRWKLYaxdruvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -21896,6 +21982,28 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nLutSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nLutSize != 0 && (pPars->nLutSize < 2 || pPars->nLutSize > 6) )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -21905,6 +22013,15 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             pLogFileName = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'Y':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Y\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pTeleFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -21949,8 +22066,22 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Constraints have to be folded (use \"fold\").\n" );
         return 0;
     }
+    if ( pTeleFile && pPars->nThreads > 1 )
+    {
+        Abc_Print( -1, "SAT solver telemetry (-Y) is not collected when several threads are used (-W).\n" );
+        return 1;
+    }
     pPars->fUseBridge = pAbc->fBridgeMode;
+    if ( pTeleFile )
+        pPars->pTele = ABC_CALLOC( Sat_Tele_t, 1 );
     pAbc->Status = Abc_NtkDarBmc3( pNtk, pPars, fOrDecomp );
+    if ( pPars->pTele )
+    {
+        if ( pPars->fVerbose )
+            Sat_TelePrint( stdout, (Sat_Tele_t *)pPars->pTele );
+        Sat_TeleDumpJson( (Sat_Tele_t *)pPars->pTele, pTeleFile, "bmc3" );
+        ABC_FREE( pPars->pTele );
+    }
     pAbc->nFrames = pNtk->vSeqModelVec ? -1 : pPars->iFrame;
     if ( pLogFileName )
         Abc_NtkWriteLogFile( pLogFileName, pAbc->pCex, pAbc->Status, pAbc->nFrames, "bmc3" );
@@ -21983,7 +22114,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-L file] [-axduvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRWK num] [-LY file] [-axduvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -21997,7 +22128,10 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",               pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",          pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-W num : the number of threads solving groups of outputs (with \"-u\" for one output) [default = %d]\n", pPars->nThreads );
+    Abc_Print( -2, "\t-K num : the LUT size for LUT-based CNF (2 <= num <= 6; 0 = use 4-input cuts) [default = %d]\n", pPars->nLutSize );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
+    Abc_Print( -2, "\t-Y file: the file name for SAT solver telemetry in JSON (not with \"-W\") [default = %s]\n",  pTeleFile ? pTeleFile : "not used" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",   pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dropping (replacing by 0) SAT outputs [default = %s]\n",    pPars->fDropSatOuts? "yes": "no" );
@@ -23668,10 +23802,11 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     extern int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars );
     Pdr_Par_t Pars, * pPars = &Pars;
     Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
+    char * pTeleFile = NULL;
     int c;
     Pdr_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCRTHGaxrmsipdgvwzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCRTHGPKYaxrmsipdglvwzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -23752,6 +23887,37 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nTimeOutGap < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nLutSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nLutSize != 0 && (pPars->nLutSize < 2 || pPars->nLutSize > 6) )
+                goto usage;
+            break;
+        case 'Y':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Y\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pTeleFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -23779,6 +23945,9 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'g':
             pPars->fSkipGeneral ^= 1;
             break;
+        case 'l':
+            pPars->fSwarm ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -23808,9 +23977,23 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -2, "The current network is not an AIG (run \"strash\").\n");
         return 0;
     }
+    if ( pTeleFile && pPars->nThreads > 1 )
+    {
+        Abc_Print( -1, "SAT solver telemetry (-Y) is not collected when several threads are used (-P).\n" );
+        return 1;
+    }
     // run the procedure
     pPars->fUseBridge = pAbc->fBridgeMode;
+    if ( pTeleFile )
+        pPars->pTele = ABC_CALLOC( Sat_Tele_t, 1 );
     pAbc->Status  = Abc_NtkDarPdr( pNtk, pPars );
+    if ( pPars->pTele )
+    {
+        if ( pPars->fVerbose )
+            Sat_TelePrint( stdout, (Sat_Tele_t *)pPars->pTele );
+        Sat_TeleDumpJson( (Sat_Tele_t *)pPars->pTele, pTeleFile, "pdr" );
+        ABC_FREE( pPars->pTele );
+    }
     pAbc->nFrames = pNtk->vSeqModelVec ? -1 : pPars->iFrame;
     Abc_FrameReplacePoStatuses( pAbc, &pPars->vOutMap );
     if ( pNtk->vSeqModelVec )
@@ -23820,7 +24003,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: pdr [-MFCRTHG <num>] [-axrmsipdgvwzh]\n" );
+    Abc_Print( -2, "usage: pdr [-MFCRTHGPK <num>] [-Y <file>] [-axrmsipdglvwzh]\n" );
     Abc_Print( -2, "\t         model checking using property directed reachability (aka IC3)\n" );
     Abc_Print( -2, "\t         pioneered by Aaron Bradley (http://ecee.colorado.edu/~bradleya/ic3/)\n" );
     Abc_Print( -2, "\t         with improvements by Niklas Een (http://een.se/niklas/)\n" );
@@ -23831,6 +24014,9 @@ usage:
     Abc_Print( -2, "\t-T num : runtime limit, in seconds (0 = no limit) [default = %d]\n",                   pPars->nTimeOut );
     Abc_Print( -2, "\t-H num : runtime limit per output, in miliseconds (with \"-a\") [default = %d]\n",     pPars->nTimeOutOne );
     Abc_Print( -2, "\t-G num : runtime gap since the last CEX (0 = no limit) [default = %d]\n",              pPars->nTimeOutGap );
+    Abc_Print( -2, "\t-P num : the number of threads solving clusters of outputs (0 = sequential) [default = %d]\n", pPars->nThreads );
+    Abc_Print( -2, "\t-K num : the LUT size for LUT-based CNF (2 <= num <= 6; 0 = default CNF) [default = %d]\n", pPars->nLutSize );
+    Abc_Print( -2, "\t-Y file: the file name for SAT solver telemetry in JSON (not with \"-P\") [default = %s]\n", pTeleFile ? pTeleFile : "not used" );
     Abc_Print( -2, "\t-a     : toggle solving all outputs even if one of them is SAT [default = %s]\n",      pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",              pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle using more effort in generalization [default = %s]\n",                 pPars->fTwoRounds? "yes": "no" );
@@ -23840,6 +24026,7 @@ usage:
     Abc_Print( -2, "\t-p     : toggle reusing proof-obligations in the last timeframe [default = %s]\n",     pPars->fReuseProofOblig? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dumping inductive invariant [default = %s]\n",                         pPars->fDumpInv? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle skipping expensive generalization step [default = %s]\n",              pPars->fSkipGeneral? "yes": "no" );
+    Abc_Print( -2, "\t-l     : toggle running differently configured threads sharing lemmas (with \"-P\") [default = %s]\n", pPars->fSwarm? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing optimization summary [default = %s]\n",                       pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing detailed stats default = %s]\n",                              pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle suppressing report about solved outputs [default = %s]\n",             pPars->fNotVerbose? "yes": "no" );
@@ -24782,11 +24969,23 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fUseMini = 0;
     int fVerbose = 0;
     int fSkipStrash = 0;
+    int nThreads = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "smvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Psmvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 0 )
+                goto usage;
+            break;
         case 's':
             fSkipStrash ^= 1;
             break;
@@ -24827,13 +25026,14 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     if ( fUseMini )
         pAig = Gia_ManReadMiniAig( FileName );
     else
-        pAig = Gia_AigerRead( FileName, fSkipStrash, 0 );
+        pAig = Gia_AigerReadMt( FileName, fSkipStrash, 0, nThreads );
     Abc_FrameUpdateGia( pAbc, pAig );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-smvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-P num] [-smvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads decoding the AND gates indexed by &w -x [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fUseMini? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
@@ -25276,9 +25476,10 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, nArgcNew;
     int fUnique = 0;
     int fMiniAig = 0;
+    int fWriteIndex = 0;
     int fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "umvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "umxvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -25288,6 +25489,9 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'm':
             fMiniAig ^= 1;
             break;
+        case 'x':
+            fWriteIndex ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -25319,14 +25523,15 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     else if ( fMiniAig )
         Gia_ManWriteMiniAig( pAbc->pGia, pFileName );
     else
-        Gia_AigerWrite( pAbc->pGia, pFileName, 0, 0 );
+        Gia_AigerWriteS( pAbc->pGia, pFileName, 0, 0, fWriteIndex );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-umvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-umxvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-m     : toggle writing MiniAIG rather than AIGER [default = %s]\n", fMiniAig? "yes" : "no" );
+    Abc_Print( -2, "\t-x     : toggle writing the index of the AND gates for &r -P [default = %s]\n", fWriteIndex? "yes" : "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -25601,11 +25806,23 @@ int Abc_CommandAbc9Hash( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pTemp;
     int c;
     int fAddStrash = 0;
+    int nThreads = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ah" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pah" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 0 )
+                goto usage;
+            break;
         case 'a':
             fAddStrash ^= 1;
             break;
@@ -25620,13 +25837,17 @@ int Abc_CommandAbc9Hash( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Hash(): There is no AIG.\n" );
         return 1;
     }
-    pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
+    if ( nThreads > 1 && !fAddStrash && pAbc->pGia->pMuxes == NULL )
+        pTemp = Gia_ManDupMt( pAbc->pGia, nThreads );
+    else
+        pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
     Abc_FrameUpdateGia( pAbc, pTemp );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-ah]\n" );
+    Abc_Print( -2, "usage: &st [-P num] [-ah]\n" );
     Abc_Print( -2, "\t        performs structural hashing\n" );
+    Abc_Print( -2, "\t-P num: the number of threads sharing the hash table [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-a    : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
     Abc_Print( -2, "\t-h    : print the command usage\n");
     return 1;
@@ -25988,7 +26209,7 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTPImvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -26036,6 +26257,17 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
         case 'I':
             if ( globalUtilOptind >= argc )
             {
@@ -26092,13 +26324,14 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNTP num] [-mvh] -I <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads (uses 64-bit words) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -26426,7 +26659,7 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Cec_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WFRSTsmdvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WFRSTPsmdvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -26485,6 +26718,17 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
         case 's':
             pPars->fSeqSimulate ^= 1;
             break;
@@ -26512,13 +26756,14 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &equiv [-WFRST num] [-smdvh]\n" );
+    Abc_Print( -2, "usage: &equiv [-WFRSTP num] [-smdvh]\n" );
     Abc_Print( -2, "\t         computes candidate equivalence classes\n" );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nFrames );
     Abc_Print( -2, "\t-R num : the max number of simulation rounds [default = %d]\n", pPars->nRounds );
     Abc_Print( -2, "\t-S num : the max number of rounds w/o refinement to stop [default = %d]\n", pPars->nNonRefines );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of simulation threads [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-s     : toggle seq vs. comb simulation [default = %s]\n", pPars->fSeqSimulate? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using two POs intead of XOR [default = %s]\n", pPars->fDualOut? "yes": "no" );
@@ -28400,12 +28645,36 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pTemp;
     int c;
     int fCSat = 0;
+    int nProcs = 1;
+    int fConfLimit = 0;
     Cec_ManSatSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CSNnmtcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CSNPKnmtcvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nCubeVars = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCubeVars < 0 || pPars->nCubeVars > 16 )
+                goto usage;
+            break;
         case 'C':
             if ( globalUtilOptind >= argc )
             {
@@ -28416,6 +28685,7 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
             globalUtilOptind++;
             if ( pPars->nBTLimit < 0 )
                 goto usage;
+            fConfLimit = 1;
             break;
         case 'S':
             if ( globalUtilOptind >= argc )
@@ -28463,6 +28733,43 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sat(): There is no AIG.\n" );
         return 1;
     }
+    if ( pPars->nCubeVars > 0 && fCSat )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Sat(): Splitting into cubes (-K) does not work with the circuit-based solver (-c).\n" );
+        return 1;
+    }
+    pPars->nCubeProcs = nProcs;
+    if ( nProcs > 1 && pPars->nCubeVars == 0 )
+    {
+        Aig_Man_t * pAig;
+        abctime clk = Abc_Clock();
+        int RetValue;
+        if ( Gia_ManRegNum(pAbc->pGia) > 0 )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Sat(): The portfolio works only for combinational miters.\n" );
+            return 1;
+        }
+        pAig = Gia_ManToAigSimple( pAbc->pGia );
+        // the default conflict limit is per node, so it is applied only if given
+        RetValue = Fra_FraigSatPortfolio( pAig, fConfLimit ? (ABC_INT64_T)pPars->nBTLimit : 0, 0, 0, 0, 0, 0, 0, nProcs, pPars->fVerbose, NULL );
+        if ( RetValue == 0 )
+        {
+            Abc_CexFreeP( &pAbc->pCex );
+            pAbc->pCex = Abc_CexCreate( 0, Gia_ManPiNum(pAbc->pGia), (int *)pAig->pData, 0, 0, 0 );
+            pAbc->pCex->iPo = Gia_ManFindFailedPoCex( pAbc->pGia, pAbc->pCex, 0 );
+            ABC_FREE( pAig->pData );
+        }
+        Aig_ManStop( pAig );
+        pAbc->Status = RetValue;
+        if ( RetValue == -1 )
+            Abc_Print( 1, "UNDECIDED      " );
+        else if ( RetValue == 0 )
+            Abc_Print( 1, "SATISFIABLE    " );
+        else
+            Abc_Print( 1, "UNSATISFIABLE  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        return 0;
+    }
     if ( fCSat )
     {
         Vec_Int_t * vCounters;
@@ -28484,11 +28791,16 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sat [-CSN <num>] [-nmctvh]\n" );
+    Abc_Print( -2, "usage: &sat [-CSNPK <num>] [-nmctvh]\n" );
     Abc_Print( -2, "\t         performs SAT solving for the combinational outputs\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-S num : the min number of variables to recycle the solver [default = %d]\n", pPars->nSatVarMax );
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
+    Abc_Print( -2, "\t-P num : solves the OR of the outputs using this many diversified solvers\n" );
+    Abc_Print( -2, "\t         sharing learned clauses; the conflict limit of each solver is\n" );
+    Abc_Print( -2, "\t         given by -C if specified, otherwise not limited [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-K num : the number of variables to split the outputs undecided within the\n" );
+    Abc_Print( -2, "\t         conflict limit into cubes solved by -P threads (0 = none; 16 = max) [default = %d]\n", pPars->nCubeVars );
     Abc_Print( -2, "\t-n     : toggle using non-chronological backtracking [default = %s]\n", pPars->fNonChrono? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-c     : toggle using circuit-based SAT solver [default = %s]\n", fCSat? "yes": "no" );
@@ -28517,7 +28829,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     Cec_ManFraSetDefaultParams( pPars );
     pPars->fSatSweeping = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WRILDCrmdwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WRILDCrmdcwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -28596,6 +28908,9 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'd':
             pPars->fDualOut ^= 1;
             break;
+        case 'c':
+            pPars->fUseCSat ^= 1;
+            break;
         case 'w':
             pPars->fVeryVerbose ^= 1;
             break;
@@ -28616,7 +28931,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-WRILDC <num>] [-rmdwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-WRILDC <num>] [-rmdcwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-R num : the number of simulation rounds [default = %d]\n", pPars->nRounds );
@@ -28627,6 +28942,7 @@ usage:
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using double output miters [default = %s]\n", pPars->fDualOut? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle using circuit-based SAT solver with learned clause reuse before MiniSat [default = %s]\n", pPars->fUseCSat? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing even more verbose information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -29182,11 +29498,12 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pSecond, * pMiter;
     char * FileName, * pTemp;
     char ** pArgvNew;
+    char * pTeleFile = NULL;
     int c, nArgcNew, fMiter = 0;
     int fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTmdvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTKPBWYmdvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -29212,6 +29529,57 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nCubeVars = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCubeVars < 0 || pPars->nCubeVars > 16 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nCubeProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCubeProcs < 1 )
+                goto usage;
+            break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nCubeBTLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCubeBTLimit < 0 )
+                goto usage;
+            break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pWarmFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'Y':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Y\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pTeleFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'm':
             fMiter ^= 1;
             break;
@@ -29235,7 +29603,16 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             return 1;
         }
         Abc_Print( 1, "Assuming the current network is a double-output miter. (Conflict limit = %d.)\n", pPars->nBTLimit );
+        if ( pTeleFile )
+            pPars->pTele = ABC_CALLOC( Sat_Tele_t, 1 );
         pAbc->Status = Cec_ManVerify( pAbc->pGia, pPars );
+        if ( pPars->pTele )
+        {
+            if ( pPars->fVerbose )
+                Sat_TelePrint( stdout, (Sat_Tele_t *)pPars->pTele );
+            Sat_TeleDumpJson( (Sat_Tele_t *)pPars->pTele, pTeleFile, "&cec" );
+            ABC_FREE( pPars->pTele );
+        }
         Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexComb );
         return 0;
     }
@@ -29278,7 +29655,16 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             Abc_Print( 0, "The verification miter is written into file \"%s\".\n", "cec_miter.aig" );
             Gia_AigerWrite( pMiter, "cec_miter.aig", 0, 0 );
         }
-        pAbc->Status = Cec_ManVerify( pMiter, pPars );
+        if ( pTeleFile )
+            pPars->pTele = ABC_CALLOC( Sat_Tele_t, 1 );
+        pAbc->Status = Cec_ManVerify( pMiter, pPars );
+        if ( pPars->pTele )
+        {
+            if ( pPars->fVerbose )
+                Sat_TelePrint( stdout, (Sat_Tele_t *)pPars->pTele );
+            Sat_TeleDumpJson( (Sat_Tele_t *)pPars->pTele, pTeleFile, "&cec" );
+            ABC_FREE( pPars->pTele );
+        }
         Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexComb );
         Gia_ManStop( pMiter );
     }
@@ -29286,10 +29672,15 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-mdvh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTKPB num] [-WY file] [-mdvh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-K num : the number of variables to split hard outputs into cubes (0 = none; 16 = max) [default = %d]\n", pPars->nCubeVars );
+    Abc_Print( -2, "\t-P num : the number of threads solving the cubes [default = %d]\n", pPars->nCubeProcs );
+    Abc_Print( -2, "\t-B num : the max number of conflicts in one cube (0 = no limit) [default = %d]\n", pPars->nCubeBTLimit );
+    Abc_Print( -2, "\t-W file: the file with equivalences proved in the previous run (updated after this run) [default = %s]\n", pPars->pWarmFile ? pPars->pWarmFile : "not used" );
+    Abc_Print( -2, "\t-Y file: the file name for SAT solver telemetry in JSON [default = %s]\n", pTeleFile ? pTeleFile : "not used" );
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle dumping dual-output miter [default = %s]\n", fDumpMiter? "yes":"no");
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", pPars->fVerbose? "yes":"no");
@@ -29655,7 +30046,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     pPars->pLutLib = (If_LibLut_t *)pAbc->pLibLut;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSqalepmrsdbgyojikfuzvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSZqalepmrsdbgyojikfuzvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -29774,6 +30165,15 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'Z':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Z\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pFuncCache = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'q':
             pPars->fPreprocess ^= 1;
             break;
@@ -30025,7 +30425,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: &if [-KCFAGR num] [-DEW float] [-S str] [-qarlepmsdbgyojikfuczvh]\n" );
+    Abc_Print( -2, "usage: &if [-KCFAGR num] [-DEW float] [-S str] [-Z file] [-qarlepmsdbgyojikfuczvh]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -30037,6 +30437,7 @@ usage:
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
     Abc_Print( -2, "\t-S str   : string representing the LUT structure [default = %s]\n", pPars->pLutStruct ? pPars->pLutStruct : "not used" );
+    Abc_Print( -2, "\t-Z file  : file keeping the results of LUT structure checks across runs [default = %s]\n", pPars->pFuncCache ? pPars->pFuncCache : "not used" );
     Abc_Print( -2, "\t-q       : toggles preprocessing using several starting points [default = %s]\n", pPars->fPreprocess? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fArea? "yes": "no" );
     Abc_Print( -2, "\t-r       : enables expansion/reduction of the best cuts [default = %s]\n", pPars->fExpRed? "yes": "no" );
@@ -30628,6 +31029,143 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Remap( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nLutSize = 6, nCutNum = 8, nTfoLevels = 3, nPercentMax = 20, fVerbose = 0;
+    int nLutsOld = 0, nLutsNew = 0, nRemapped = 0, nRemapMax;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCLRvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nLutSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nLutSize < 2 || nLutSize > 8 )
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCutNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCutNum < 1 || nCutNum > 16 )
+                goto usage;
+            break;
+        case 'L':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-L\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nTfoLevels = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nTfoLevels < 0 )
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nPercentMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nPercentMax < 0 || nPercentMax > 100 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Remap(): There is no AIG to map.\n" );
+        return 1;
+    }
+    if ( !Gia_ManHasMapping(pAbc->pGia) && pAbc->pGia2 && Gia_ManHasMapping(pAbc->pGia2) )
+    {
+        nLutsOld = Gia_ManLutNum( pAbc->pGia2 );
+        nLutsNew = Gia_ManTransferMappingPartial( pAbc->pGia2, pAbc->pGia );
+        if ( fVerbose )
+            Abc_Print( 1, "Transferred %d (%.2f %%) out of %d LUTs of the previous AIG.\n",
+                nLutsNew, 100.0 * nLutsNew / Abc_MaxInt(1, nLutsOld), nLutsOld );
+    }
+    // the limit on the remapped nodes (0 = no limit; at least one node otherwise)
+    nRemapMax = nPercentMax < 100 ? Abc_MaxInt( 1, (int)((double)nPercentMax * Gia_ManAndNum(pAbc->pGia) / 100) ) : 0;
+    if ( nPercentMax > 0 )
+    {
+        nRemapped = Gia_ManRemapIncremental( pAbc->pGia, NULL, nLutSize, nCutNum, nTfoLevels, nRemapMax, fVerbose );
+        if ( nRemapped < 0 )
+            return 1;
+    }
+    if ( nPercentMax == 0 || (nRemapMax > 0 && nRemapped > nRemapMax) )
+    {
+        // too much is changed; the priority-cut mapper does better from scratch
+        If_Par_t Pars, * pPars = &Pars;
+        Gia_Man_t * pNew;
+        if ( fVerbose && nPercentMax == 0 )
+            Abc_Print( 1, "Mapping the AIG from scratch.\n" );
+        else if ( fVerbose )
+            Abc_Print( 1, "Mapping the AIG from scratch because more than %d %% of the nodes should be remapped.\n", nPercentMax );
+        Vec_IntFreeP( &pAbc->pGia->vMapping );
+        Gia_ManSetIfParsDefault( pPars );
+        pPars->nLutSize = nLutSize;
+        pPars->nCutsMax = nCutNum;
+        pNew = Gia_ManPerformMapping( pAbc->pGia, pPars, 1 );
+        if ( pNew == NULL )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Remap(): Mapping of GIA has failed.\n" );
+            return 1;
+        }
+        Abc_FrameUpdateGia( pAbc, pNew );
+    }
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &remap [-KCLR num] [-vh]\n" );
+    Abc_Print( -2, "\t           incrementally repairs LUT mapping of the current AIG;\n" );
+    Abc_Print( -2, "\t           the LUTs of the current mapping (or, if the AIG is not mapped,\n" );
+    Abc_Print( -2, "\t           those of the previous AIG transferred into the current one\n" );
+    Abc_Print( -2, "\t           by matching the nodes with the same simulation signatures)\n" );
+    Abc_Print( -2, "\t           are kept unless they are missing or their cones have changed;\n" );
+    Abc_Print( -2, "\t           after heavy restructuring (such as &syn2 or &b), few LUTs\n" );
+    Abc_Print( -2, "\t           survive and the AIG is mapped from scratch as by &if\n" );
+    Abc_Print( -2, "\t-K num   : the LUT size (2 <= num <= 8) [default = %d]\n", nLutSize );
+    Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= num <= 16) [default = %d]\n", nCutNum );
+    Abc_Print( -2, "\t-L num   : the AIG levels above the changes where LUTs are reselected [default = %d]\n", nTfoLevels );
+    Abc_Print( -2, "\t-R num   : the max percentage of AND nodes remapped incrementally;\n" );
+    Abc_Print( -2, "\t           otherwise, the AIG is mapped from scratch (0 = always from scratch;\n" );
+    Abc_Print( -2, "\t           100 = no limit) [default = %d]\n", nPercentMax );
+    Abc_Print( -2, "\t-v       : toggle printing optimization summary [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h       : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -32433,6 +32971,106 @@ usage:
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9PortProve( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Bmc_PortPar_t Pars, * pPars = &Pars; int c;
+    Bmc_PortSetDefaultParams( pPars );
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PTpbiavh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads <= 0 )
+                goto usage;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nTimeOut = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nTimeOut < 0 )
+                goto usage;
+            break;
+        case 'p':
+            pPars->fUsePdr ^= 1;
+            break;
+        case 'b':
+            pPars->fUseBmc ^= 1;
+            break;
+        case 'i':
+            pPars->fUseInt ^= 1;
+            break;
+        case 'a':
+            pPars->fUseInd ^= 1;
+            break;
+        case 'v':
+            pPars->fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9PortProve(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManRegNum(pAbc->pGia) == 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9PortProve(): The AIG is combinational.\n" );
+        return 1;
+    }
+    pAbc->Status  = Gia_ManPortfolioProve( pAbc->pGia, pPars );
+    pAbc->nFrames = pPars->iFrame;
+    Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexSeq );
+    if ( pAbc->Status == 1 )
+        Abc_Print( 1, "Property proved.  " );
+    else if ( pAbc->Status == 0 )
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAbc->pCex->iPo, pAbc->pGia->pName, pAbc->pCex->iFrame );
+    else
+        Abc_Print( 1, "Property UNDECIDED.  " );
+    Abc_Print( 1, "\n" );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &pprove [-PT num] [-pbiavh]\n" );
+    Abc_Print( -2, "\t         races several model checkers on parallel threads\n" );
+    Abc_Print( -2, "\t         and returns the first verdict produced by any of them\n" );
+    Abc_Print( -2, "\t-P num : the number of concurrent threads [default = %d]\n",         pPars->nThreads );
+    Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n",     pPars->nTimeOut );
+    Abc_Print( -2, "\t-p     : toggle using property directed reachability [default = %s]\n", pPars->fUsePdr?  "yes": "no" );
+    Abc_Print( -2, "\t-b     : toggle using bounded model checking [default = %s]\n",      pPars->fUseBmc?  "yes": "no" );
+    Abc_Print( -2, "\t-i     : toggle using interpolation [default = %s]\n",               pPars->fUseInt?  "yes": "no" );
+    Abc_Print( -2, "\t-a     : toggle using induction [default = %s]\n",                   pPars->fUseInd?  "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",      pPars->fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
 
 /**Function*************************************************************
 
@@ -32455,6 +33093,7 @@ int Abc_CommandAbc9Bmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nFramesAdd    =   50;  // the number of additional frames
     pPars->nConfLimit    =    0;  // maximum number of conflicts at a node
     pPars->nTimeOut      =    0;  // timeout in seconds
+    pPars->nSatVarMax    =    0;  // the number of SAT variables to recycle the solver
     pPars->fLoadCnf      =    0;  // dynamic CNF loading
     pPars->fDumpFrames   =    0;  // dump unrolled timeframes
     pPars->fUseSynth     =    0;  // use synthesis
@@ -32466,7 +33105,7 @@ int Abc_CommandAbc9Bmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nFailOuts     =    0;  // the number of failed outputs
     pPars->nDropOuts     =    0;  // the number of dropped outputs
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFATdscvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFATVdscvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -32514,6 +33153,17 @@ int Abc_CommandAbc9Bmc( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nTimeOut < 0 )
                 goto usage;
             break;
+        case 'V':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-V\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nSatVarMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nSatVarMax < 0 )
+                goto usage;
+            break;
         case 'd':
             pPars->fDumpFrames ^= 1;
             break;
@@ -32546,12 +33196,13 @@ int Abc_CommandAbc9Bmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &bmc [-SFAT num] [-dscvwh]\n" );
+    Abc_Print( -2, "usage: &bmc [-SFATV num] [-dscvwh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking\n" );
     Abc_Print( -2, "\t-S num : the starting timeframe [default = %d]\n",                      pPars->nStart );
     Abc_Print( -2, "\t-F num : the maximum number of timeframes [default = %d]\n",            pPars->nFramesMax );
     Abc_Print( -2, "\t-A num : the number of additional frames to unroll [default = %d]\n",   pPars->nFramesAdd );
     Abc_Print( -2, "\t-T num : approximate timeout in seconds [default = %d]\n",              pPars->nTimeOut );
+    Abc_Print( -2, "\t-V num : the number of SAT variables to recycle the solver (0 = no limit) [default = %d]\n", pPars->nSatVarMax );
     Abc_Print( -2, "\t-d     : toggle dumping unfolded timeframes [default = %s]\n",          pPars->fDumpFrames?  "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle synthesizing unrolled timeframes [default = %s]\n",     pPars->fUseSynth?    "yes": "no" );
     Abc_Print( -2, "\t-c     : toggle using old CNF computation [default = %s]\n",            pPars->fUseOldCnf?   "yes": "no" );
@@ -1513,7 +1513,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fSimplify, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1554,6 +1554,17 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
 
+    // simplify the CNF while keeping the CI/CO variables
+    if ( fSimplify )
+    {
+        Cnf_SimpPars_t Pars, * pPars = &Pars;
+        Vec_Int_t * vFrozen = Cnf_DataCollectFrozen( pCnf, pMan );
+        Cnf_SimpSetDefaultParams( pPars );
+        pPars->fVerbose = fVerbose;
+        Cnf_DataSimplify( pCnf, vFrozen, pPars );
+        Vec_IntFree( vFrozen );
+    }
+
 /*
     // write the network for verification
     pManCnf = Cnf_ManRead();
@@ -1581,7 +1592,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose )
+int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fSimplify, int nProcs, int fVerbose, void * pTele )
 {
     Aig_Man_t * pMan;
     int RetValue;//, clk = Abc_Clock();
@@ -1589,7 +1600,7 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     assert( Abc_NtkLatchNum(pNtk) == 0 );
 //    assert( Abc_NtkPoNum(pNtk) == 1 );
     pMan = Abc_NtkToDar( pNtk, 0, 0 );
-    RetValue = Fra_FraigSat( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fVerbose ); 
+    RetValue = Fra_FraigSatInt( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fSimplify, nProcs, fVerbose, pTele ); 
     pNtk->pModel = (int *)pMan->pData, pMan->pData = NULL;
     Aig_ManStop( pMan );
     return RetValue;
@@ -76,7 +76,7 @@ struct Abc_ManRec_t_
     unsigned *        pTempTruth;               // temporary truth table
     char *            pTempDepths;              // temporary depths
     int  *            pTempleaves;              // temporary leaves
-    unsigned          tempUsign;
+    word              tempUsign;
     unsigned          tempNleaves;
     unsigned          currentCost;
     int               currentDelay;
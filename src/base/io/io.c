@@ -1947,16 +1947,18 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int fFastAlgo;
     int fAllPrimes;
     int fChangePol;
+    int fSimplify;
     int fVerbose;
-    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fSimplify, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
     fAllPrimes = 0;
     fChangePol = 1;
+    fSimplify = 0;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcsvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1972,6 +1974,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
             case 'c':
                 fChangePol ^= 1;
                 break;
+            case 's':
+                fSimplify ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -1998,9 +2003,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     // call the corresponding file writer
     if ( fFastAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fSimplify, fVerbose );
     else if ( fNewAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fSimplify, fVerbose );
     else if ( fAllPrimes )
         Io_WriteCnf( pAbc->pNtkCur, pFileName, 1 );
     else
@@ -2008,12 +2013,13 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-nfpcsvh] <file>\n" );
     fprintf( pAbc->Err, "\t         writes the miter cone into a CNF file\n" );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
     fprintf( pAbc->Err, "\t-c     : toggle adjasting polarity of internal variables [default = %s]\n", fChangePol? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-s     : toggle simplifying CNF while keeping CI/CO variables [default = %s]\n", fSimplify? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
@@ -20,6 +20,7 @@
 
 #include "base/abc/abc.h"
 #include "mainInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -74,6 +75,7 @@ extern void Abc85_End( Abc_Frame_t * pAbc );
 ***********************************************************************/
 void Abc_FrameInit( Abc_Frame_t * pAbc )
 {
+    Abc_SimdInit();
     Cmd_Init( pAbc );
     Cmd_CommandExecute( pAbc, "set checkread" ); 
     Io_Init( pAbc );
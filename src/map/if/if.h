@@ -32,6 +32,7 @@
 #include <assert.h>
 
 #include "misc/vec/vec.h"
+#include "misc/vec/vecMem.h"
 #include "misc/mem/mem.h"
 #include "misc/tim/tim.h"
 #include "misc/util/utilNam.h"
@@ -104,6 +105,7 @@ struct If_Par_t_
     float              Epsilon;       // value used in comparison floating point numbers
     int                nRelaxRatio;   // delay relaxation ratio
     int                nStructType;   // type of the structure
+    int                nProcs;        // the number of threads for cut computation
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -125,6 +127,7 @@ struct If_Par_t_
     int                fDeriveLuts;   // enables deriving LUT structures
     int                fVerbose;      // the verbosity flag
     char *             pLutStruct;    // LUT structure
+    char *             pFuncCache;    // the file with the results of cut function checks
     float              WireDelay;     // wire delay
     // internal parameters
     int                fDelayOpt;     // special delay optimization
@@ -199,6 +202,7 @@ struct If_Man_t_
     unsigned           uSharedMask;   // mask of shared variables
     int                nShared;       // the number of shared variables
     int                fReqTimeWarn;  // warning about exceeding required times was printed
+    int                fDeferRefs;    // reference updates are done after mapping the level
     // SOP balancing
     Vec_Int_t *        vCover;        // used to compute ISOP
     Vec_Wrd_t *        vAnds;         // intermediate storage
@@ -228,6 +232,10 @@ struct If_Man_t_
     int                nCutsCountAll;
     int                nCutsUselessAll;
     int                nCuts5, nCuts5a;
+    int                nFuncChecks;   // the number of calls to check the cut function
+    int                nFuncCheckHits;// the number of checks found in the table
+    Vec_Mem_t *        vTtMem[IF_MAX_LUTSIZE+1];  // unique truth tables of the cuts by size
+    Vec_Str_t *        vTtDecs[IF_MAX_LUTSIZE+1]; // memoized results of checking the functions
 //    Abc_Nam_t *        pNamDsd;
     int                iNamVar;
     Dss_Man_t *        pDsdMan;
@@ -253,7 +261,8 @@ struct If_Cut_t_
     float              Power;         // the power flow
     float              Delay;         // delay of the cut
     int                iDsd;          // DSD ID of the cut
-    unsigned           uSign;         // cut signature
+    int                iCutFunc;      // function ID of the cut (with complemented attribute)
+    word               uSign;         // cut signature
     unsigned           Cost    : 13;  // the user's cost of the cut (related to IF_COST_MAX)
     unsigned           fCompl  :  1;  // the complemented attribute 
     unsigned           fUser   :  1;  // using the user's area and delay
@@ -375,7 +384,7 @@ static inline void       If_ObjSetCopy( If_Obj_t * pObj, void * pCopy )      { p
 static inline void       If_ObjSetChoice( If_Obj_t * pObj, If_Obj_t * pEqu ) { pObj->pEquiv = pEqu;                  }
 
 static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { return &pObj->CutBest;                }
-static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
+static inline word       If_ObjCutSign( unsigned ObjId )                     { return ((word)1 << (ObjId % 63));     }
 
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
@@ -462,6 +471,9 @@ static inline void       If_AndClear( If_And_t * pNode )                     { *
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== ifCache.c ==========================================================*/
+extern void            If_ManFuncCacheLoad( If_Man_t * p );
+extern void            If_ManFuncCacheSave( If_Man_t * p );
 /*=== ifCore.c ===========================================================*/
 extern int             If_ManPerformMapping( If_Man_t * p );
 extern int             If_ManPerformMappingComb( If_Man_t * p );
@@ -546,6 +558,11 @@ extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, char * pLabel );
+/*=== ifMapMt.c ===========================================================*/
+extern int             If_ManMappingMtIsOk( If_Man_t * p, int Mode );
+extern If_Obj_t **     If_ManLevelOrder( If_Man_t * p, int ** ppStarts );
+extern int             If_ManCrossCutLevel( If_Man_t * p );
+extern void            If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSeq.c =============================================================*/
@@ -563,6 +580,8 @@ extern int             If_CutTruthMinimize( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_CutTruthPermute( unsigned * pOut, unsigned * pIn, int nVars, float * pDelays, int * pVars );
 extern int             If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 );
 extern int             If_CutComputeTruth2( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 );
+extern void            If_ManFuncTableStart( If_Man_t * p, int nLeaves );
+extern int             If_CutCheckFunc( If_Man_t * p, If_Cut_t * pCut );
 /*=== ifUtil.c ============================================================*/
 extern void            If_ManCleanNodeCopy( If_Man_t * p );
 extern void            If_ManCleanCutData( If_Man_t * p );
@@ -0,0 +1,303 @@
+/**CFile****************************************************************
+
+  FileName    [ifCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Persistent cache of cut function checks.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 21, 2006.]
+
+  Revision    [$Id: ifCache.c,v 1.00 2006/11/21 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifdef WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "if.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IF_CACHE_MAGIC  "ABC IF function cache 1"
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the signature of the cut function check.]
+
+  Description [The results in the file can only be reused by the mapper
+  running the same check with the same parameters. The signature lists
+  every parameter that may change the result of the check (for example,
+  the 8-input check in If_CutPerformCheck75() depends on fDeriveLuts).
+  Returns 0 if the check is not known.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ManFuncCacheSign( If_Man_t * p, char * pSign )
+{
+    If_Par_t * pPars = p->pPars;
+    char * pCheck;
+    if ( pPars->pFuncCell == NULL || pPars->nLutSize > IF_MAX_LUTSIZE )
+        return 0;
+    if ( pPars->pLutStruct )
+        pCheck = pPars->pLutStruct;
+    else if ( pPars->fEnableCheck75 )
+        pCheck = "75";
+    else if ( pPars->fEnableCheck75u )
+        pCheck = "75u";
+    else if ( pPars->fEnableCheck10 )
+        pCheck = "10";
+    else if ( pPars->fEnableCheck08 )
+        pCheck = "08";
+    else if ( pPars->fEnableCheck07 )
+        pCheck = "07";
+    else
+        return 0;
+    // these are all the parameters read by the check functions (see ifDec*.c)
+    sprintf( pSign, "K=%d %s=%s T=%d M=%d Z=%d C75=%d C75u=%d", pPars->nLutSize, pPars->pLutStruct ? "struct" : "check",
+        pCheck, pPars->nStructType, pPars->fCutMin, pPars->fDeriveLuts, pPars->fEnableCheck75, pPars->fEnableCheck75u );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the checksum of the file contents.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word If_ManFuncCacheChecksum( unsigned char * pData, int nBytes )
+{
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        Hash = (Hash ^ pData[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the results of cut function checks from file.]
+
+  Description [The file contains the signature of the check followed by
+  the truth tables of the functions (whose first minterm is 0) and the
+  results of the check for each function and its complement (0 = not
+  computed, 1 = failed, 2 = succeeded), grouped by the support size.
+  Only the pass/fail result is stored, not the implementation, because
+  the check functions do not return it; the LUT structure is derived
+  again when the mapping is converted into a network.
+  The results are added to the tables of the mapper, without changing
+  those already computed, so that the same procedure merges the file
+  on disk before the tables are saved. The file is skipped if its
+  checksum or signature does not match. Returns the number of
+  functions read from the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ManFuncCacheRead( If_Man_t * p, char * pSign, int fWarn )
+{
+    char * pFileName = p->pPars->pFuncCache;
+    unsigned char * pData, * pCur, * pEnd;
+    word * pTruth, Checksum;
+    int nBytes, nWords, nLutSize, nLeaves, nEntries, i, k, iFunc, nLoaded = 0;
+    FILE * pFile;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    fseek( pFile, 0, SEEK_END );
+    nBytes = ftell( pFile );
+    rewind( pFile );
+    pData = ABC_ALLOC( unsigned char, Abc_MaxInt(nBytes, 1) );
+    nBytes = (int)fread( pData, 1, nBytes, pFile );
+    fclose( pFile );
+    // check the contents
+    pCur = pData + strlen(IF_CACHE_MAGIC) + 1 + strlen(pSign) + 1;
+    pEnd = pData + nBytes - sizeof(word);
+    if ( pEnd < pCur + 2 * sizeof(int) )
+        goto finish;
+    memcpy( &Checksum, pEnd, sizeof(word) );
+    if ( Checksum != If_ManFuncCacheChecksum(pData, nBytes - sizeof(word)) )
+    {
+        if ( fWarn )
+            Abc_Print( 0, "The function cache \"%s\" is corrupted and will be overwritten.\n", pFileName );
+        goto finish;
+    }
+    if ( strncmp((char *)pData, IF_CACHE_MAGIC "\n", strlen(IF_CACHE_MAGIC) + 1) ||
+         strncmp((char *)pData + strlen(IF_CACHE_MAGIC) + 1, pSign, strlen(pSign)) || pCur[-1] != '\n' )
+    {
+        if ( fWarn )
+            Abc_Print( 0, "The function cache \"%s\" was derived with different parameters and will be overwritten.\n", pFileName );
+        goto finish;
+    }
+    memcpy( &nWords, pCur, sizeof(int) );    pCur += sizeof(int);
+    memcpy( &nLutSize, pCur, sizeof(int) );  pCur += sizeof(int);
+    if ( nWords != Abc_TtWordNum(p->pPars->nLutSize) || nLutSize != p->pPars->nLutSize )
+        goto finish;
+    // add the functions
+    pTruth = ABC_ALLOC( word, nWords );
+    for ( nLeaves = 0; nLeaves <= nLutSize && pCur + sizeof(int) <= pEnd; nLeaves++ )
+    {
+        memcpy( &nEntries, pCur, sizeof(int) );  pCur += sizeof(int);
+        if ( nEntries < 0 || pCur + (size_t)nEntries * (sizeof(word) * nWords + 2) > pEnd )
+            break;
+        if ( nEntries > 0 )
+            If_ManFuncTableStart( p, nLeaves );
+        for ( i = 0; i < nEntries; i++ )
+        {
+            memcpy( pTruth, pCur, sizeof(word) * nWords );  pCur += sizeof(word) * nWords;
+            if ( (pTruth[0] & 1) || pCur[0] > 2 || pCur[1] > 2 )
+                break;
+            iFunc = Vec_MemHashInsert( p->vTtMem[nLeaves], pTruth );
+            Vec_StrFillExtra( p->vTtDecs[nLeaves], 2 * Vec_MemEntryNum(p->vTtMem[nLeaves]), 0 );
+            for ( k = 0; k < 2; k++ )
+                if ( Vec_StrEntry(p->vTtDecs[nLeaves], 2 * iFunc + k) == 0 )
+                    Vec_StrWriteEntry( p->vTtDecs[nLeaves], 2 * iFunc + k, (char)pCur[k] );
+            pCur += 2;
+            nLoaded++;
+        }
+        if ( i < nEntries )
+            break;
+    }
+    ABC_FREE( pTruth );
+finish:
+    ABC_FREE( pData );
+    return nLoaded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the results of cut function checks from file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManFuncCacheLoad( If_Man_t * p )
+{
+    char pSign[1000];
+    int nLoaded;
+    if ( p->pPars->pFuncCache == NULL || !If_ManFuncCacheSign(p, pSign) )
+        return;
+    nLoaded = If_ManFuncCacheRead( p, pSign, 1 );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Loaded %d functions from the function cache \"%s\".\n", nLoaded, p->pPars->pFuncCache );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the results of cut function checks into file.]
+
+  Description [The current contents of the file are merged first, so that
+  the results saved by other runs since this run has started are kept.
+  The file is written under a temporary name, which includes the process
+  ID, and renamed, so that a concurrent run never reads an incomplete file
+  and never writes into the same temporary file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManFuncCachePush( Vec_Str_t * vData, void * pBuffer, int nBytes )
+{
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        Vec_StrPush( vData, ((char *)pBuffer)[i] );
+}
+void If_ManFuncCacheSave( If_Man_t * p )
+{
+    char pSign[1000], * pFileName = p->pPars->pFuncCache, * pFileTemp;
+    int nWords = Abc_TtWordNum(p->pPars->nLutSize), nLutSize = p->pPars->nLutSize;
+    int nLeaves, nEntries, i, nSaved = 0;
+    Vec_Str_t * vData;
+    word Checksum;
+    FILE * pFile;
+    if ( pFileName == NULL || !If_ManFuncCacheSign(p, pSign) )
+        return;
+    If_ManFuncCacheRead( p, pSign, 0 );
+    vData = Vec_StrAlloc( 1 << 16 );
+    If_ManFuncCachePush( vData, IF_CACHE_MAGIC "\n", strlen(IF_CACHE_MAGIC) + 1 );
+    If_ManFuncCachePush( vData, pSign, strlen(pSign) );
+    Vec_StrPush( vData, '\n' );
+    If_ManFuncCachePush( vData, &nWords, sizeof(int) );
+    If_ManFuncCachePush( vData, &nLutSize, sizeof(int) );
+    for ( nLeaves = 0; nLeaves <= nLutSize; nLeaves++ )
+    {
+        nEntries = p->vTtMem[nLeaves] ? Vec_MemEntryNum(p->vTtMem[nLeaves]) : 0;
+        If_ManFuncCachePush( vData, &nEntries, sizeof(int) );
+        for ( i = 0; i < nEntries; i++ )
+        {
+            If_ManFuncCachePush( vData, Vec_MemReadEntry(p->vTtMem[nLeaves], i), sizeof(word) * nWords );
+            Vec_StrPush( vData, Vec_StrEntry(p->vTtDecs[nLeaves], 2 * i + 0) );
+            Vec_StrPush( vData, Vec_StrEntry(p->vTtDecs[nLeaves], 2 * i + 1) );
+        }
+        nSaved += nEntries;
+    }
+    Checksum = If_ManFuncCacheChecksum( (unsigned char *)Vec_StrArray(vData), Vec_StrSize(vData) );
+    If_ManFuncCachePush( vData, &Checksum, sizeof(word) );
+    // write the file
+    pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 30 );
+    sprintf( pFileTemp, "%s.%d.tmp", pFileName, (int)getpid() );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+        Abc_Print( 0, "Cannot open file \"%s\" for writing the function cache.\n", pFileTemp );
+    else
+    {
+        int nWritten = (int)fwrite( Vec_StrArray(vData), 1, Vec_StrSize(vData), pFile );
+        fclose( pFile );
+        if ( nWritten != Vec_StrSize(vData) )
+        {
+            Abc_Print( 0, "Writing the function cache into file \"%s\" has failed.\n", pFileTemp );
+            remove( pFileTemp );
+        }
+        else if ( rename(pFileTemp, pFileName) && (remove(pFileName), rename(pFileTemp, pFileName)) )
+        {
+            Abc_Print( 0, "Cannot rename file \"%s\" into \"%s\".\n", pFileTemp, pFileName );
+            remove( pFileTemp );
+        }
+        else if ( p->pPars->fVerbose )
+            Abc_Print( 1, "Saved %d functions into the function cache \"%s\".\n", nSaved, pFileName );
+    }
+    ABC_FREE( pFileTemp );
+    Vec_StrFree( vData );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
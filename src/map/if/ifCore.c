@@ -46,12 +46,16 @@ extern abctime s_MappingTime;
 ***********************************************************************/
 int If_ManPerformMapping( If_Man_t * p )
 {
+    int nCrossCut;
     p->pPars->fAreaOnly = p->pPars->fArea; // temporary
 
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    nCrossCut = If_ManCrossCut(p);
+    if ( If_ManMappingMtIsOk(p, 0) )
+        nCrossCut = Abc_MaxInt( nCrossCut, If_ManCrossCutLevel(p) );
+    If_ManSetupSetAll( p, nCrossCut );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
 
@@ -35,7 +35,8 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns 1 if pDom is contained in pCut.]
 
-  Description []
+  Description [Both cuts have their leaves sorted in the increasing
+  order, so the containment is checked in one pass over the leaves.]
                
   SideEffects []
 
@@ -44,13 +45,17 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
 {
+    int nDom = pDom->nLeaves, nCut = pCut->nLeaves;
     int i, k;
-    for ( i = 0; i < (int)pDom->nLeaves; i++ )
+    for ( i = k = 0; i < nDom; i++, k++ )
     {
-        for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            if ( pDom->pLeaves[i] == pCut->pLeaves[k] )
-                break;
-        if ( k == (int)pCut->nLeaves ) // node i in pDom is not contained in pCut
+        // quit if the remaining leaves of pCut are too few
+        if ( nDom - i > nCut - k )
+            return 0;
+        while ( pCut->pLeaves[k] < pDom->pLeaves[i] )
+            if ( ++k == nCut )
+                return 0;
+        if ( pCut->pLeaves[k] != pDom->pLeaves[i] ) // node i in pDom is not contained in pCut
             return 0;
     }
     // every node in pDom is contained in pCut
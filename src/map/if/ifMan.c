@@ -94,6 +94,9 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     p->pConst1->Type   = IF_CONST1;
     p->pConst1->fPhase = 1;
     p->nObjs[IF_CONST1]++;
+    // load the results of cut function checks
+    if ( pPars->pFuncCache && pPars->pFuncCell )
+        If_ManFuncCacheLoad( p );
     return p;
 }
 
@@ -138,6 +141,7 @@ void If_ManRestart( If_Man_t * p )
 ***********************************************************************/
 void If_ManStop( If_Man_t * p )
 {
+    int i;
     {
 //        extern void If_CluHashFindMedian( If_Man_t * p );
 //        extern void If_CluHashTableCheck( If_Man_t * p );
@@ -146,7 +150,6 @@ void If_ManStop( If_Man_t * p )
     }
     if ( p->pPars->fVerbose && p->nCutsUselessAll )
     {
-        int i;
         for ( i = 0; i <= 16; i++ )
             if ( p->nCutsUseless[i] )
                 Abc_Print( 1, "Useless cuts %2d  = %9d  (out of %9d)  (%6.2f %%)\n", i, p->nCutsUseless[i], p->nCutsCount[i], 100.0*p->nCutsUseless[i]/(p->nCutsCount[i]+1) );
@@ -154,6 +157,26 @@ void If_ManStop( If_Man_t * p )
     }
     if ( p->pPars->fVerbose && p->nCuts5 )
         Abc_Print( 1, "Statistics about 5-cuts: Total = %d  Non-decomposable = %d (%.2f %%)\n", p->nCuts5, p->nCuts5-p->nCuts5a, 100.0*(p->nCuts5-p->nCuts5a)/p->nCuts5 );
+    if ( p->pPars->fVerbose && p->nFuncChecks )
+    {
+        int nFuncs = 0;
+        double Memory = 0;
+        for ( i = 0; i <= IF_MAX_LUTSIZE; i++ )
+            if ( p->vTtMem[i] )
+                nFuncs += Vec_MemEntryNum(p->vTtMem[i]), Memory += Vec_MemMemory(p->vTtMem[i]);
+        Abc_Print( 1, "Function checks = %d  Memoized = %d (%.2f %%)  Unique functions = %d  Memory = %.2f MB\n", 
+            p->nFuncChecks, p->nFuncCheckHits, 100.0*p->nFuncCheckHits/p->nFuncChecks, nFuncs, Memory/(1<<20) );
+    }
+    if ( p->pPars->pFuncCache && p->pPars->pFuncCell )
+        If_ManFuncCacheSave( p );
+    for ( i = 0; i <= IF_MAX_LUTSIZE; i++ )
+    {
+        if ( p->vTtMem[i] == NULL )
+            continue;
+        Vec_MemHashFree( p->vTtMem[i] );
+        Vec_MemFreeP( &p->vTtMem[i] );
+        Vec_StrFreeP( &p->vTtDecs[i] );
+    }
     if ( p->pPars->fUseDsd )
     {
 /*
@@ -429,6 +452,7 @@ void If_ManSetupSet( If_Man_t * p, If_Set_t * pSet )
 void If_ManSetupCutTriv( If_Man_t * p, If_Cut_t * pCut, int ObjId )
 {
     pCut->fCompl     = 0;
+    pCut->iCutFunc   = -1;
     pCut->nLimit     = p->pPars->nLutSize;
     pCut->nLeaves    = 1;
     pCut->pLeaves[0] = p->pPars->fLiftLeaves? (ObjId << 8) : ObjId;
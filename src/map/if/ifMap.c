@@ -44,13 +44,12 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
   SeeAlso     []
 
 ***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
+static inline int If_WordCountOnes( word uWord )
 {
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
+    uWord = (uWord & ABC_CONST(0x5555555555555555)) + ((uWord>>1) & ABC_CONST(0x5555555555555555));
+    uWord = (uWord & ABC_CONST(0x3333333333333333)) + ((uWord>>2) & ABC_CONST(0x3333333333333333));
+    uWord = (uWord & ABC_CONST(0x0F0F0F0F0F0F0F0F)) + ((uWord>>4) & ABC_CONST(0x0F0F0F0F0F0F0F0F));
+    return  (int)((uWord * ABC_CONST(0x0101010101010101)) >> 56);
 }
 
 /**Function*************************************************************
@@ -152,7 +151,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
     }
     // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fDeferRefs )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
@@ -218,6 +217,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             continue;
         // compute the truth table
         pCut->fCompl = 0;
+        pCut->iCutFunc = -1;
         if ( p->pPars->fTruth )
         {
 //            abctime clk = Abc_Clock();
@@ -229,7 +229,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             if ( p->pPars->pFuncCell && RetValue < 2 )
             {
                 assert( pCut->nLimit >= 4 && pCut->nLimit <= 16 );
-                pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(pCut), pCut->nLimit, pCut->nLeaves, p->pPars->pLutStruct );
+                pCut->fUseless = !If_CutCheckFunc( p, pCut );
                 p->nCutsUselessAll += pCut->fUseless;
                 p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
                 p->nCutsCountAll++;
@@ -357,7 +357,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     }
     assert( p->pPars->fSeqMap || If_ObjCutBest(pObj)->nLeaves > 1 );
     // ref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fDeferRefs )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
     if ( If_ObjCutBest(pObj)->fUseless )
         Abc_Print( 1, "The best cut is useless.\n" );
@@ -369,7 +369,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 
 
     // free the cuts
-    If_ManDerefNodeCutSet( p, pObj );
+    if ( !p->fDeferRefs )
+        If_ManDerefNodeCutSet( p, pObj );
 }
 
 /**Function*************************************************************
@@ -528,6 +529,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManMappingMtIsOk(p, Mode) )
+        If_ManPerformMappingMt( p, Mode, fPreprocess );
     else
     {
     //    pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
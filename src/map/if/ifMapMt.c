@@ -0,0 +1,325 @@
+/**CFile****************************************************************
+
+  FileName    [ifMapMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Multi-threaded cut enumeration by level wavefronts.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 21, 2006.]
+
+  Revision    [$Id: ifMapMt.c,v 1.00 2006/11/21 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the smallest number of nodes of one level given to one thread
+#define IF_MT_NODES_MIN   256
+
+// the range of nodes of one level mapped by one thread
+typedef struct If_MtData_t_ If_MtData_t;
+struct If_MtData_t_
+{
+    If_Man_t       Man;          // private copy of the manager
+    If_Obj_t **    ppNodes;      // the nodes ordered by level
+    int            iStart;       // the first node
+    int            iStop;        // the node after the last one
+    int            Mode;         // the mapping mode
+    int            fPreprocess;  // the preprocessing flag
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can use several threads.]
+
+  Description [Only delay and area-flow rounds of the combinational
+  mapper without choices, boxes, and cut functions are supported.
+  In these rounds, computing the cuts of a node only reads the data
+  of the nodes on the lower levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManMappingMtIsOk( If_Man_t * p, int Mode )
+{
+#ifdef ABC_USE_PTHREADS
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcs < 2 || Mode == 2 )
+        return 0;
+    if ( p->pManTim || p->nChoices || pPars->fSeqMap || pPars->fTruth || pPars->fUseDsd )
+        return 0;
+    if ( pPars->fUserRecLib || pPars->fDelayOpt || pPars->nGateSize > 0 || pPars->pFuncCost || pPars->pFuncUser )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orders the internal nodes by level.]
+
+  Description [Returns the array of nodes. The nodes of level L are
+  stored in the range from (*ppStarts)[L] to (*ppStarts)[L+1]. Within
+  each level, the nodes are in the topological order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_Obj_t ** If_ManLevelOrder( If_Man_t * p, int ** ppStarts )
+{
+    If_Obj_t ** ppNodes, * pObj;
+    int * pStarts, i, Level;
+    pStarts = ABC_CALLOC( int, p->nLevelMax + 2 );
+    If_ManForEachNode( p, pObj, i )
+        pStarts[pObj->Level + 1]++;
+    for ( Level = 1; Level <= p->nLevelMax + 1; Level++ )
+        pStarts[Level] += pStarts[Level - 1];
+    ppNodes = ABC_ALLOC( If_Obj_t *, If_ManAndNum(p) );
+    If_ManForEachNode( p, pObj, i )
+        ppNodes[pStarts[pObj->Level]++] = pObj;
+    for ( Level = p->nLevelMax + 1; Level > 0; Level-- )
+        pStarts[Level] = pStarts[Level - 1];
+    pStarts[0] = 0;
+    *ppStarts = pStarts;
+    return ppNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the max number of cutsets for level wavefronts.]
+
+  Description [Similar to If_ManCrossCut() but assumes that the cutsets
+  of one level are allocated at the same time and released after the
+  whole level is mapped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p )
+{
+    If_Obj_t ** ppNodes, * pObj, * pFanin;
+    int * pStarts, i, Level, nCutSize = 0, nCutSizeMax = 0;
+    ppNodes = If_ManLevelOrder( p, &pStarts );
+    for ( Level = 1; Level <= p->nLevelMax; Level++ )
+    {
+        nCutSize += pStarts[Level + 1] - pStarts[Level];
+        if ( nCutSizeMax < nCutSize )
+            nCutSizeMax = nCutSize;
+        for ( i = pStarts[Level]; i < pStarts[Level + 1]; i++ )
+        {
+            pObj = ppNodes[i];
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    ABC_FREE( pStarts );
+    ABC_FREE( ppNodes );
+    return nCutSizeMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the range of nodes of one level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManMappingMtRange( If_MtData_t * pData )
+{
+    int i;
+    for ( i = pData->iStart; i < pData->iStop; i++ )
+        If_ObjPerformMappingAnd( &pData->Man, pData->ppNodes[i], pData->Mode, pData->fPreprocess );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Mapping thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * If_ManMappingMtThread( void * pArg )
+{
+    If_ManMappingMtRange( (If_MtData_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the internal nodes using several threads.]
+
+  Description [The nodes are mapped one level at a time. The nodes of
+  one level are divided into contiguous ranges, one for each thread.
+  Each thread uses a private copy of the manager with its own list of
+  free cutsets and its own counters. The reference counters and the
+  cutsets of the fanins are updated by the calling thread after the
+  level is mapped. In the area-flow mode, the references of the current
+  cuts of the level are released before computing the new cuts and
+  the references of the new cuts are added after that, so the cuts of
+  the nodes on one level are compared using the same reference counters.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess )
+{
+    If_MtData_t * pData;
+    If_Obj_t ** ppNodes, * pObj;
+    If_Set_t * pSet;
+    int * pStarts, nProcs = p->pPars->nProcs;
+    int i, k, Level, nNodes, nChunk, nThreads;
+    assert( If_ManMappingMtIsOk(p, Mode) );
+    ppNodes = If_ManLevelOrder( p, &pStarts );
+    pData = ABC_CALLOC( If_MtData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pData[i].Man = *p;
+        pData[i].Man.pFreeList   = NULL;
+        pData[i].Man.nCutsMerged = 0;
+        pData[i].Man.nCutsTotal  = 0;
+        pData[i].Man.fDeferRefs  = 1;
+        pData[i].ppNodes     = ppNodes;
+        pData[i].Mode        = Mode;
+        pData[i].fPreprocess = fPreprocess;
+    }
+    for ( Level = 1; Level <= p->nLevelMax; Level++ )
+    {
+        nNodes = pStarts[Level + 1] - pStarts[Level];
+        if ( nNodes == 0 )
+            continue;
+        // release the references of the current cuts
+        if ( Mode )
+            for ( i = pStarts[Level]; i < pStarts[Level + 1]; i++ )
+                if ( ppNodes[i]->nRefs > 0 )
+                    If_CutAreaDeref( p, If_ObjCutBest(ppNodes[i]) );
+        // divide the nodes among the threads and give them the cutsets
+        nThreads = Abc_MaxInt( 1, Abc_MinInt(nProcs, nNodes / IF_MT_NODES_MIN) );
+        nChunk   = (nNodes + nThreads - 1) / nThreads;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pData[i].iStart = pStarts[Level] + Abc_MinInt( i * nChunk, nNodes );
+            pData[i].iStop  = pStarts[Level] + Abc_MinInt( (i + 1) * nChunk, nNodes );
+            for ( k = pData[i].iStart; k < pData[i].iStop; k++ )
+            {
+                assert( p->pFreeList != NULL );
+                pSet = p->pFreeList;
+                p->pFreeList = pSet->pNext;
+                pSet->pNext = pData[i].Man.pFreeList;
+                pData[i].Man.pFreeList = pSet;
+            }
+        }
+        // compute the cuts
+        if ( nThreads == 1 )
+            If_ManMappingMtRange( pData );
+#ifdef ABC_USE_PTHREADS
+        else
+        {
+            pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+            int status;
+            for ( i = 0; i < nThreads; i++ )
+            {
+                status = pthread_create( pThreads + i, NULL, If_ManMappingMtThread, (void *)(pData + i) );
+                assert( status == 0 );
+            }
+            for ( i = 0; i < nThreads; i++ )
+            {
+                status = pthread_join( pThreads[i], NULL );
+                assert( status == 0 );
+            }
+            ABC_FREE( pThreads );
+        }
+#endif // pthreads are used
+        // collect the counters
+        for ( i = 0; i < nThreads; i++ )
+        {
+            assert( pData[i].Man.pFreeList == NULL );
+            p->nCutsMerged += pData[i].Man.nCutsMerged;
+            p->nCutsTotal  += pData[i].Man.nCutsTotal;
+            pData[i].Man.nCutsMerged = 0;
+            pData[i].Man.nCutsTotal  = 0;
+        }
+        // reference the new cuts and release the cutsets of the fanins
+        for ( i = pStarts[Level]; i < pStarts[Level + 1]; i++ )
+        {
+            pObj = ppNodes[i];
+            if ( Mode && pObj->nRefs > 0 )
+                If_CutAreaRef( p, If_ObjCutBest(pObj) );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    ABC_FREE( pData );
+    ABC_FREE( pStarts );
+    ABC_FREE( ppNodes );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -264,8 +264,12 @@ void If_ManImproveNodeUpdate( If_Man_t * p, If_Obj_t * pObj, Vec_Ptr_t * vFront
     If_CutAreaDeref( p, pCut );
     // update the node's cut
     pCut->nLeaves = Vec_PtrSize(vFront);
+    pCut->uSign = 0;
     Vec_PtrForEachEntry( If_Obj_t *, vFront, pFanin, i )
+    {
         pCut->pLeaves[i] = pFanin->Id;
+        pCut->uSign |= If_ObjCutSign( pFanin->Id );
+    }
     If_CutOrder( pCut );
     // ref the new cut
     If_CutAreaRef( p, pCut );
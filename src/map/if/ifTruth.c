@@ -563,7 +563,7 @@ static inline int If_CutTruthMinimize21( If_Man_t * p, If_Cut_t * pCut )
 {
     word * pTruth = If_CutTruthW(pCut);
     int i, k, nVars = If_CutLeaveNum(pCut);
-    unsigned uSign = 0;
+    word uSign = 0;
     for ( i = k = 0; i < nVars; i++ )
     {
         if ( !Abc_TtHasVar( pTruth, nVars, i ) )
@@ -712,6 +712,71 @@ int If_CutComputeTruth3( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut
 }
 */
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the table of unique functions with the given support.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManFuncTableStart( If_Man_t * p, int nLeaves )
+{
+    if ( p->vTtMem[nLeaves] != NULL )
+        return;
+    p->vTtMem[nLeaves] = Vec_MemAlloc( Abc_TtWordNum(p->pPars->nLutSize), 12 );
+    Vec_MemHashAlloc( p->vTtMem[nLeaves], 10000 );
+    p->vTtDecs[nLeaves] = Vec_StrAlloc( 10000 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the cut function using the user's procedure.]
+
+  Description [The truth tables of the cuts are stored in the table of
+  unique functions, one table for each number of leaves. The table keeps
+  one entry for a function and its complement. The cut is assigned the
+  function ID with the complemented attribute. The results of calling
+  the user's procedure are memoized by the function ID, so that the
+  check is performed once for each unique function. The table is kept
+  in addition to the truth tables of the cuts, which are still computed
+  and read by the other procedures; it saves runtime, not memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutCheckFunc( If_Man_t * p, If_Cut_t * pCut )
+{
+    word pCopy[1024], * pTruth = If_CutTruthW(pCut);
+    int nWords = Abc_TtWordNum( pCut->nLimit );
+    int nLeaves = pCut->nLeaves, iFunc, Value;
+    assert( p->pPars->pFuncCell != NULL );
+    assert( nWords <= 1024 );
+    p->nFuncChecks++;
+    if ( (int)pCut->nLimit != p->pPars->nLutSize )
+        return p->pPars->pFuncCell( p, If_CutTruth(pCut), pCut->nLimit, nLeaves, p->pPars->pLutStruct );
+    If_ManFuncTableStart( p, nLeaves );
+    Abc_TtCopy( pCopy, pTruth, nWords, (int)(pTruth[0] & 1) );
+    iFunc = Vec_MemHashInsert( p->vTtMem[nLeaves], pCopy );
+    pCut->iCutFunc = Abc_Var2Lit( iFunc, (int)(pTruth[0] & 1) );
+    // the entries are 0 (not computed), 1 (failed), and 2 (succeeded)
+    Vec_StrFillExtra( p->vTtDecs[nLeaves], 2 * Vec_MemEntryNum(p->vTtMem[nLeaves]), 0 );
+    Value = Vec_StrEntry( p->vTtDecs[nLeaves], pCut->iCutFunc );
+    if ( Value == 0 )
+    {
+        Value = 1 + (p->pPars->pFuncCell( p, If_CutTruth(pCut), pCut->nLimit, nLeaves, p->pPars->pLutStruct ) != 0);
+        Vec_StrWriteEntry( p->vTtDecs[nLeaves], pCut->iCutFunc, (char)Value );
+    }
+    else
+        p->nFuncCheckHits++;
+    return Value - 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
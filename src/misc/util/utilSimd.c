@@ -0,0 +1,406 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [Vectorized kernels for bit-parallel simulation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilSimd.h"
+
+// the vectorized kernels are compiled using target attributes of GCC and Clang,
+// so that the rest of the code does not need to be compiled for a particular CPU
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#define ABC_SIMD_TARGET(x) __attribute__((target(x)))
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static int s_SimdLevel = ABC_SIMD_NONE;
+
+static inline int Abc_SimdCountOnes64( word x )
+{
+    x = x - ((x >> 1) & ABC_CONST(0x5555555555555555));
+    x = (x & ABC_CONST(0x3333333333333333)) + ((x >> 2) & ABC_CONST(0x3333333333333333));
+    x = (x + (x >> 4)) & ABC_CONST(0x0F0F0F0F0F0F0F0F);
+    return (int)((x * ABC_CONST(0x0101010101010101)) >> 56);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Used for the tails of the vectorized kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((p0[w] ^ Mask0) & (p1[w] ^ Mask1)) ^ MaskOut;
+}
+static int Abc_SimdIsEqualScalar( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != (p1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+static int Abc_SimdIsZeroScalar( unsigned * p, unsigned Mask, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( p[w] ^ Mask )
+            return 0;
+    return 1;
+}
+static int Abc_SimdCountOnesScalar( unsigned * p, unsigned Mask, int nWords )
+{
+    word Data;
+    int w, Counter = 0;
+    for ( w = 0; w + 1 < nWords; w += 2 )
+    {
+        memcpy( &Data, p + w, sizeof(word) );
+        Counter += Abc_SimdCountOnes64( Data ^ (((word)Mask << 32) | Mask) );
+    }
+    if ( w < nWords )
+        Counter += Abc_SimdCountOnes64( (word)(p[w] ^ Mask) );
+    return Counter;
+}
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [SSE2 kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_SIMD_TARGET("sse2")
+static void Abc_SimdAndSse2( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+    __m128i m0 = _mm_set1_epi32( (int)Mask0 );
+    __m128i m1 = _mm_set1_epi32( (int)Mask1 );
+    __m128i mo = _mm_set1_epi32( (int)MaskOut );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m128i a = _mm_xor_si128( _mm_loadu_si128((__m128i *)(p0 + w)), m0 );
+        __m128i b = _mm_xor_si128( _mm_loadu_si128((__m128i *)(p1 + w)), m1 );
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_xor_si128(_mm_and_si128(a, b), mo) );
+    }
+    Abc_SimdAndScalar( pOut + w, p0 + w, p1 + w, Mask0, Mask1, MaskOut, nWords - w );
+}
+ABC_SIMD_TARGET("sse2")
+static int Abc_SimdIsEqualSse2( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+    __m128i m = _mm_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m128i a = _mm_loadu_si128( (__m128i *)(p0 + w) );
+        __m128i b = _mm_xor_si128( _mm_loadu_si128((__m128i *)(p1 + w)), m );
+        if ( _mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) != 0xFFFF )
+            return 0;
+    }
+    return Abc_SimdIsEqualScalar( p0 + w, p1 + w, Mask, nWords - w );
+}
+ABC_SIMD_TARGET("sse2")
+static int Abc_SimdIsZeroSse2( unsigned * p, unsigned Mask, int nWords )
+{
+    __m128i m = _mm_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        if ( _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((__m128i *)(p + w)), m)) != 0xFFFF )
+            return 0;
+    return Abc_SimdIsZeroScalar( p + w, Mask, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Counting ones uses the nibble look-up table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_SIMD_TARGET("avx2")
+static void Abc_SimdAndAvx2( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+    __m256i m0 = _mm256_set1_epi32( (int)Mask0 );
+    __m256i m1 = _mm256_set1_epi32( (int)Mask1 );
+    __m256i mo = _mm256_set1_epi32( (int)MaskOut );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i a = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), m0 );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), m1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_and_si256(a, b), mo) );
+    }
+    Abc_SimdAndScalar( pOut + w, p0 + w, p1 + w, Mask0, Mask1, MaskOut, nWords - w );
+}
+ABC_SIMD_TARGET("avx2")
+static int Abc_SimdIsEqualAvx2( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+    __m256i m = _mm256_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(p0 + w) );
+        __m256i b = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), m );
+        __m256i x = _mm256_xor_si256( a, b );
+        if ( !_mm256_testz_si256(x, x) )
+            return 0;
+    }
+    return Abc_SimdIsEqualScalar( p0 + w, p1 + w, Mask, nWords - w );
+}
+ABC_SIMD_TARGET("avx2")
+static int Abc_SimdIsZeroAvx2( unsigned * p, unsigned Mask, int nWords )
+{
+    __m256i m = _mm256_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i x = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p + w)), m );
+        if ( !_mm256_testz_si256(x, x) )
+            return 0;
+    }
+    return Abc_SimdIsZeroScalar( p + w, Mask, nWords - w );
+}
+ABC_SIMD_TARGET("avx2")
+static int Abc_SimdCountOnesAvx2( unsigned * p, unsigned Mask, int nWords )
+{
+    __m256i Table = _mm256_setr_epi8( 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4, 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4 );
+    __m256i Low   = _mm256_set1_epi8( 0x0F );
+    __m256i m     = _mm256_set1_epi32( (int)Mask );
+    __m256i Acc   = _mm256_setzero_si256();
+    word Res[4];
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i x  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p + w)), m );
+        __m256i c0 = _mm256_shuffle_epi8( Table, _mm256_and_si256(x, Low) );
+        __m256i c1 = _mm256_shuffle_epi8( Table, _mm256_and_si256(_mm256_srli_epi16(x, 4), Low) );
+        Acc = _mm256_add_epi64( Acc, _mm256_sad_epu8(_mm256_add_epi8(c0, c1), _mm256_setzero_si256()) );
+    }
+    _mm256_storeu_si256( (__m256i *)Res, Acc );
+    return (int)(Res[0] + Res[1] + Res[2] + Res[3]) + Abc_SimdCountOnesScalar( p + w, Mask, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_SIMD_TARGET("avx512f,avx512bw")
+static void Abc_SimdAndAvx512( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+    __m512i m0 = _mm512_set1_epi32( (int)Mask0 );
+    __m512i m1 = _mm512_set1_epi32( (int)Mask1 );
+    __m512i mo = _mm512_set1_epi32( (int)MaskOut );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i a = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), m0 );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), m1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_and_si512(a, b), mo) );
+    }
+    Abc_SimdAndScalar( pOut + w, p0 + w, p1 + w, Mask0, Mask1, MaskOut, nWords - w );
+}
+ABC_SIMD_TARGET("avx512f,avx512bw")
+static int Abc_SimdIsEqualAvx512( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+    __m512i m = _mm512_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(p0 + w) );
+        __m512i b = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), m );
+        if ( _mm512_cmpneq_epi32_mask(a, b) )
+            return 0;
+    }
+    return Abc_SimdIsEqualScalar( p0 + w, p1 + w, Mask, nWords - w );
+}
+ABC_SIMD_TARGET("avx512f,avx512bw")
+static int Abc_SimdIsZeroAvx512( unsigned * p, unsigned Mask, int nWords )
+{
+    __m512i m = _mm512_set1_epi32( (int)Mask );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+        if ( _mm512_cmpneq_epi32_mask(_mm512_loadu_si512((void *)(p + w)), m) )
+            return 0;
+    return Abc_SimdIsZeroScalar( p + w, Mask, nWords - w );
+}
+ABC_SIMD_TARGET("avx512f,avx512bw")
+static int Abc_SimdCountOnesAvx512( unsigned * p, unsigned Mask, int nWords )
+{
+    __m512i Table = _mm512_set4_epi32( 0x04030302, 0x03020201, 0x03020201, 0x02010100 );
+    __m512i Low   = _mm512_set1_epi8( 0x0F );
+    __m512i m     = _mm512_set1_epi32( (int)Mask );
+    __m512i Acc   = _mm512_setzero_si512();
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i x  = _mm512_xor_si512( _mm512_loadu_si512((void *)(p + w)), m );
+        __m512i c0 = _mm512_shuffle_epi8( Table, _mm512_and_si512(x, Low) );
+        __m512i c1 = _mm512_shuffle_epi8( Table, _mm512_and_si512(_mm512_srli_epi16(x, 4), Low) );
+        Acc = _mm512_add_epi64( Acc, _mm512_sad_epu8(_mm512_add_epi8(c0, c1), _mm512_setzero_si512()) );
+    }
+    return (int)_mm512_reduce_add_epi64( Acc ) + Abc_SimdCountOnesScalar( p + w, Mask, nWords - w );
+}
+
+#endif // ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the instruction set used by the kernels.]
+
+  Description [The instruction set can be lowered by setting environment
+  variable ABC_SIMD to 0 (none), 1 (SSE2), 2 (AVX2), or 3 (AVX-512).
+  It is detected once by Abc_SimdInit() when the ABC frame is started,
+  before any threads are created; until then, the scalar kernels are used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SimdDetect()
+{
+    int Level = ABC_SIMD_NONE;
+    char * pVar = getenv( "ABC_SIMD" );
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("sse2") )
+        Level = ABC_SIMD_SSE2;
+    if ( __builtin_cpu_supports("avx2") )
+        Level = ABC_SIMD_AVX2;
+    if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") )
+        Level = ABC_SIMD_AVX512;
+#endif
+    if ( pVar && atoi(pVar) >= 0 && atoi(pVar) < Level )
+        Level = atoi(pVar);
+    return Level;
+}
+void Abc_SimdInit()
+{
+    s_SimdLevel = Abc_SimdDetect();
+}
+int Abc_SimdLevel()
+{
+    return s_SimdLevel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Kernels dispatched to the instruction set.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdAndLong( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+#ifdef ABC_SIMD_X86
+    switch ( Abc_SimdLevel() )
+    {
+    case ABC_SIMD_AVX512: Abc_SimdAndAvx512( pOut, p0, p1, Mask0, Mask1, MaskOut, nWords ); return;
+    case ABC_SIMD_AVX2:   Abc_SimdAndAvx2( pOut, p0, p1, Mask0, Mask1, MaskOut, nWords );   return;
+    case ABC_SIMD_SSE2:   Abc_SimdAndSse2( pOut, p0, p1, Mask0, Mask1, MaskOut, nWords );   return;
+    }
+#endif
+    Abc_SimdAndScalar( pOut, p0, p1, Mask0, Mask1, MaskOut, nWords );
+}
+int Abc_SimdIsEqualLong( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+#ifdef ABC_SIMD_X86
+    switch ( Abc_SimdLevel() )
+    {
+    case ABC_SIMD_AVX512: return Abc_SimdIsEqualAvx512( p0, p1, Mask, nWords );
+    case ABC_SIMD_AVX2:   return Abc_SimdIsEqualAvx2( p0, p1, Mask, nWords );
+    case ABC_SIMD_SSE2:   return Abc_SimdIsEqualSse2( p0, p1, Mask, nWords );
+    }
+#endif
+    return Abc_SimdIsEqualScalar( p0, p1, Mask, nWords );
+}
+int Abc_SimdIsZeroLong( unsigned * p, unsigned Mask, int nWords )
+{
+#ifdef ABC_SIMD_X86
+    switch ( Abc_SimdLevel() )
+    {
+    case ABC_SIMD_AVX512: return Abc_SimdIsZeroAvx512( p, Mask, nWords );
+    case ABC_SIMD_AVX2:   return Abc_SimdIsZeroAvx2( p, Mask, nWords );
+    case ABC_SIMD_SSE2:   return Abc_SimdIsZeroSse2( p, Mask, nWords );
+    }
+#endif
+    return Abc_SimdIsZeroScalar( p, Mask, nWords );
+}
+int Abc_SimdCountOnesLong( unsigned * p, unsigned Mask, int nWords )
+{
+#ifdef ABC_SIMD_X86
+    switch ( Abc_SimdLevel() )
+    {
+    case ABC_SIMD_AVX512: return Abc_SimdCountOnesAvx512( p, Mask, nWords );
+    case ABC_SIMD_AVX2:   return Abc_SimdCountOnesAvx2( p, Mask, nWords );
+    }
+#endif
+    return Abc_SimdCountOnesScalar( p, Mask, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,120 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [Vectorized kernels for bit-parallel simulation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the instruction sets used by the kernels
+#define ABC_SIMD_NONE       0
+#define ABC_SIMD_SSE2       1
+#define ABC_SIMD_AVX2       2
+#define ABC_SIMD_AVX512     3
+
+// the shortest simulation info (in 32-bit words) passed to the vectorized kernels;
+// for shorter info, the function call costs more than it saves
+#define ABC_SIMD_MIN_WORDS 16
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ===========================================================*/
+extern void          Abc_SimdInit();
+extern int           Abc_SimdLevel();
+extern void          Abc_SimdAndLong( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords );
+extern int           Abc_SimdIsEqualLong( unsigned * p0, unsigned * p1, unsigned Mask, int nWords );
+extern int           Abc_SimdIsZeroLong( unsigned * p, unsigned Mask, int nWords );
+extern int           Abc_SimdCountOnesLong( unsigned * p, unsigned Mask, int nWords );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// computes pOut = ((p0 ^ Mask0) & (p1 ^ Mask1)) ^ MaskOut, where masks are 0 or ~0
+static inline void Abc_SimdAnd( unsigned * pOut, unsigned * p0, unsigned * p1, unsigned Mask0, unsigned Mask1, unsigned MaskOut, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        Abc_SimdAndLong( pOut, p0, p1, Mask0, Mask1, MaskOut, nWords );
+        return;
+    }
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((p0[w] ^ Mask0) & (p1[w] ^ Mask1)) ^ MaskOut;
+}
+// returns 1 if p0 == p1 ^ Mask
+static inline int Abc_SimdIsEqual( unsigned * p0, unsigned * p1, unsigned Mask, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+        return Abc_SimdIsEqualLong( p0, p1, Mask, nWords );
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != (p1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+// returns 1 if p ^ Mask is all zeros
+static inline int Abc_SimdIsZero( unsigned * p, unsigned Mask, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+        return Abc_SimdIsZeroLong( p, Mask, nWords );
+    for ( w = 0; w < nWords; w++ )
+        if ( p[w] ^ Mask )
+            return 0;
+    return 1;
+}
+// counts the number of ones in p ^ Mask
+static inline int Abc_SimdCountOnes( unsigned * p, unsigned Mask, int nWords )
+{
+    unsigned uWord;
+    int w, Counter = 0;
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+        return Abc_SimdCountOnesLong( p, Mask, nWords );
+    for ( w = 0; w < nWords; w++ )
+    {
+        uWord = p[w] ^ Mask;
+        uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
+        uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
+        uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
+        uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
+        Counter += (uWord & 0x0000FFFF) + (uWord>>16);
+    }
+    return Counter;
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -96,6 +96,10 @@ static inline int     Vec_SetMemoryAll( Vec_Set_t * p )          { return (p->iP
 #define Vec_SetForEachEntry( Type, pVec, nSize, pSet, p, s )   \
     for ( p = 0; p <= pVec->iPage; p++ )                       \
         for ( s = 2; s < Vec_SetLimit(pVec->pPages[p]) && ((pSet) = (Type)(pVec->pPages[p] + (s))); s += nSize )
+// the same as above while starting from the entry with handle h
+#define Vec_SetForEachEntryStart( Type, pVec, nSize, pSet, p, s, h )   \
+    for ( p = Vec_SetHandPage(pVec, h); p <= pVec->iPage; p++ )       \
+        for ( s = (p == Vec_SetHandPage(pVec, h) ? Vec_SetHandShift(pVec, h) : 2); s < Vec_SetLimit(pVec->pPages[p]) && ((pSet) = (Type)(pVec->pPages[p] + (s))); s += nSize )
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -273,6 +277,30 @@ static inline void Vec_SetShrinkLimits( Vec_Set_t * p )
     for ( i = 0; i <= p->iPage; i++ )
         Vec_SetWriteLimit( p->pPages[i], Vec_SetLimitS(p->pPages[i]) );
 }
+static inline void Vec_SetShrinkLimitsStart( Vec_Set_t * p, int h )
+{
+    int i;
+    for ( i = Vec_SetHandPage(p, h); i <= p->iPage; i++ )
+        Vec_SetWriteLimit( p->pPages[i], Vec_SetLimitS(p->pPages[i]) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the unused pages to the system.]
+
+  Description [Keeps one spare page after the current one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_SetFreeUnused( Vec_Set_t * p )
+{
+    int i;
+    for ( i = p->iPage + 2; i < p->nPagesAlloc; i++ )
+        ABC_FREE( p->pPages[i] );
+}
 
 
 ABC_NAMESPACE_HEADER_END
@@ -20,6 +20,7 @@
 
 #include "fsimInt.h"
 #include "aig/ssw/ssw.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -184,19 +185,7 @@ static inline void Fsim_ManSimulateNode( Fsim_Man_t * p, int iNode, int iFan0, i
     unsigned * pInfo  = Fsim_SimData( p, iNode % p->nFront );
     unsigned * pInfo0 = Fsim_SimData( p, Fsim_Lit2Var(iFan0) % p->nFront );
     unsigned * pInfo1 = Fsim_SimData( p, Fsim_Lit2Var(iFan1) % p->nFront );
-    int w;
-    if ( Fsim_LitIsCompl(iFan0) && Fsim_LitIsCompl(iFan1) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-    else if ( Fsim_LitIsCompl(iFan0) && !Fsim_LitIsCompl(iFan1) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    else if ( !Fsim_LitIsCompl(iFan0) && Fsim_LitIsCompl(iFan1) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w] & ~pInfo1[w];
-    else //if ( !Fsim_LitIsCompl(iFan0) && !Fsim_LitIsCompl(iFan1) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w] & pInfo1[w];
+    Abc_SimdAnd( pInfo, pInfo0, pInfo1, Fsim_LitIsCompl(iFan0) ? ~0 : 0, Fsim_LitIsCompl(iFan1) ? ~0 : 0, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -51,6 +51,10 @@ struct Cec_ParSat_t_
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
+    int              fUseCSat;      // use circuit-based solver before the CNF-based one
+    int              nCubeVars;     // the number of cube variables for hard outputs (0 = no cubes)
+    int              nCubeProcs;    // the number of threads solving the cubes
+    void *           pTele;         // SAT solver telemetry (Sat_Tele_t) collected if not NULL
     int              fVerbose;      // verbose stats
 };
 
@@ -69,6 +73,7 @@ struct Cec_ParSim_t_
     int              fSeqSimulate;  // performs sequential simulation
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
+    int              nThreads;      // the number of simulation threads
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -107,6 +112,10 @@ struct Cec_ParFra_t_
     int              fDualOut;      // miter with separate outputs
     int              fColorDiff;    // miter with separate outputs
     int              fSatSweeping;  // enable SAT sweeping
+    int              fUseCSat;      // use circuit-based solver before the CNF-based one
+    void *           pTele;         // SAT solver telemetry (Sat_Tele_t) collected if not NULL
+    Vec_Int_t *      vLits;         // if not NULL, literals of the input AIG remapped into the result
+    Vec_Int_t *      vEquivs;       // if not NULL, union-find over the input AIG objects proved equivalent
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -121,6 +130,11 @@ struct Cec_ParCec_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
+    int              nCubeVars;     // the number of cube variables for hard outputs (0 = no cubes)
+    int              nCubeProcs;    // the number of threads solving the cubes
+    int              nCubeBTLimit;  // conflict limit for one cube (0 = no limit)
+    void *           pTele;         // SAT solver telemetry (Sat_Tele_t) collected if not NULL
+    char *           pWarmFile;     // file with proved equivalences from the previous run
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the number of failed output
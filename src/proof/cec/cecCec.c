@@ -120,6 +120,57 @@ Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the dual-output miter using cubes.]
+
+  Description [Returns 1 if all outputs are proved, 0 if one of them
+  is disproved (the counter-example is saved in pMiter->pCexComb),
+  -1 if some outputs are undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifyCubes( Gia_Man_t * pMiter, Cec_ParCec_t * pPars )
+{
+    Gia_Man_t * pTemp = Gia_ManTransformMiter( pMiter );
+    Vec_Int_t * vCex = Vec_IntAlloc( Gia_ManCiNum(pMiter) );
+    Gia_Obj_t * pObj;
+    int i, k, Lit, status, RetValue = 1;
+    abctime clkTotal = Abc_Clock();
+    Gia_ManForEachPo( pTemp, pObj, i )
+    {
+        if ( Gia_ObjFaninLit0p(pTemp, pObj) == 0 )
+            continue;
+        status = Cec_ManSolveCubes( pTemp, i, pPars->nCubeVars, pPars->nCubeProcs, pPars->nCubeBTLimit, pPars->fVerbose, vCex, pPars->pTele );
+        if ( status == -1 )
+            RetValue = -1;
+        if ( status != 0 )
+            continue;
+        Cec_ManTransformPattern( pMiter, i, NULL );
+        Vec_IntForEachEntry( vCex, Lit, k )
+            if ( !Abc_LitIsCompl(Lit) )
+                Abc_InfoSetBit( pMiter->pCexComb->pData, Abc_Lit2Var(Lit) );
+        pPars->iOutFail = i;
+        RetValue = 0;
+        break;
+    }
+    Gia_ManStop( pTemp );
+    Vec_IntFree( vCex );
+    if ( RetValue == 1 )
+        Abc_Print( 1, "Networks are equivalent.   " );
+    else if ( RetValue == 0 )
+        Abc_Print( 1, "Networks are NOT EQUIVALENT.   " );
+    else if ( pPars->fVerbose )
+        Abc_Print( 1, "Networks are UNDECIDED after cube-and-conquer.   " );
+    if ( RetValue != -1 || pPars->fVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    fflush( stdout );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -208,6 +259,8 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     int fDumpUndecided = 0;
     Cec_ParFra_t ParsFra, * pParsFra = &ParsFra;
     Gia_Man_t * p, * pNew;
+    Vec_Wrd_t * vSigs = NULL;
+    Vec_Int_t * vLits = NULL, * vEquivs = NULL;
     int RetValue;
     abctime clk = Abc_Clock();
     abctime clkTotal = Abc_Clock();
@@ -223,6 +276,19 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     Gia_ManEquivFixOutputPairs( p );
     p = Gia_ManCleanup( pNew = p );
     Gia_ManStop( pNew );
+    // seed the equivalences proved in the previous run
+    if ( pPars->pWarmFile )
+    {
+        vSigs   = Cec_ManWarmSigs( p );
+        vLits   = Vec_IntAlloc( Gia_ManObjNum(p) );
+        vEquivs = Vec_IntAlloc( Gia_ManObjNum(p) );
+        pNew = Cec_ManWarmStart( p, vSigs, pPars->pWarmFile, vLits, vEquivs, pPars->fVerbose );
+        if ( pNew != NULL )
+        {
+            Gia_ManStop( p );
+            p = pNew;
+        }
+    }
     // sweep for equivalences
     Cec_ManFraSetDefaultParams( pParsFra );
     pParsFra->nItersMax    = 1000;
@@ -231,8 +297,19 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     pParsFra->fVerbose     = pPars->fVerbose;
     pParsFra->fCheckMiter  = 1;
     pParsFra->fDualOut     = 1;
+    pParsFra->pTele        = pPars->pTele;
+    pParsFra->vLits        = vLits;
+    pParsFra->vEquivs      = vEquivs;
     pNew = Cec_ManSatSweeping( p, pParsFra );
     pPars->iOutFail = pParsFra->iOutFail;
+    // save the proved equivalences for the next run
+    if ( pPars->pWarmFile )
+    {
+        Cec_ManWarmSave( vSigs, vEquivs, pPars->pWarmFile, pPars->fVerbose );
+        Vec_WrdFree( vSigs );
+        Vec_IntFree( vLits );
+        Vec_IntFree( vEquivs );
+    }
     // update
     pInit->pCexComb = p->pCexComb; p->pCexComb = NULL;
     Gia_ManStop( p );
@@ -271,6 +348,19 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
         Gia_ManStop( pNew );
         return -1;
     }
+    // split the hard outputs into cubes
+    if ( pPars->nCubeVars )
+    {
+        RetValue = Cec_ManVerifyCubes( pNew, pPars );
+        if ( RetValue == 0 || RetValue == 1 )
+        {
+            p->pCexComb = pNew->pCexComb; pNew->pCexComb = NULL;
+            if ( p->pCexComb && !Gia_ManVerifyCex( p, p->pCexComb, 1 ) )
+                Abc_Print( 1, "Counter-example simulation has failed.\n" );
+            Gia_ManStop( pNew );
+            return RetValue;
+        }
+    }
     // call other solver
     if ( pPars->fVerbose )
         Abc_Print( 1, "Calling the old CEC engine.\n" );
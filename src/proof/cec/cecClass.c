@@ -638,6 +638,116 @@ int Cec_ManSimAnalyzeOutputs( Cec_ManSim_t * p )
     return p->pCexes != NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round using several threads.]
+
+  Description [Allocates simulation info for all objects at once, so that
+  the threads can simulate disjoint ranges of words without reference
+  counting. The classes are refined after simulation in the same order
+  as in Cec_ManSimSimulateRound(). Returns the number of PO entry if
+  failed; 0 otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimSimulateRoundMt( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos )
+{
+    Gia_Obj_t * pObj;
+    unsigned * pMemsOld = p->pMems;
+    unsigned * pRes0, * pRes;
+    word * pFlat;
+    int nStride = 1 + (p->nWords + 1) / 2;
+    int i, k, w, iCiId = 0, iCoId = 0;
+    // allocate score counters
+    ABC_FREE( p->pScores );
+    if ( p->pBestState )
+        p->pScores = ABC_CALLOC( int, 32 * p->nWords );
+    // the info of object i starts with the reference counter in the upper half of word nStride*i
+    pFlat = ABC_CALLOC( word, (size_t)nStride * Gia_ManObjNum(p->pAig) + 1 );
+    p->pMems = (unsigned *)pFlat;
+    for ( i = 0; i < Gia_ManObjNum(p->pAig); i++ )
+    {
+        p->pSimInfo[i] = 2 * nStride * i + 1;
+        p->pMems[p->pSimInfo[i]] = 0x7FFFFFFF;
+    }
+    // assign the CIs
+    Gia_ManForEachCi( p->pAig, pObj, k )
+    {
+        pRes = Cec_ObjSim( p, Gia_ObjId(p->pAig, pObj) );
+        if ( Gia_ObjValue(pObj) == 0 )
+        {
+            iCiId++;
+            continue;
+        }
+        if ( vInfoCis ) 
+        {
+            pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, iCiId++ );
+            for ( w = 0; w < p->nWords; w++ )
+                pRes[w] = pRes0[w];
+        }
+        else
+        {
+            for ( w = 0; w < p->nWords; w++ )
+                pRes[w] = Gia_ManRandom( 0 );
+        }
+        // make sure the first pattern is always zero
+        pRes[0] ^= (pRes[0] & 1);
+    }
+    // simulate the nodes
+    Gia_ManSimulateWordsMt( p->pAig, pFlat + 1, nStride, (p->nWords + 1) / 2, p->pPars->nThreads );
+    // refine the classes
+    Vec_IntClear( p->vRefinedC );
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( vInfoCos )
+            {
+                pRes0 = Cec_ObjSim( p, i );
+                pRes  = (unsigned *)Vec_PtrEntry( vInfoCos, iCoId++ );
+                for ( w = 0; w < p->nWords; w++ )
+                    pRes[w] = pRes0[w];
+            }
+            continue;
+        }
+        if ( Gia_ObjValue(pObj) == 0 )
+            continue;
+        pRes = Cec_ObjSim( p, i );
+        // if this node is candidate constant, collect it
+        if ( Gia_ObjIsConst(p->pAig, i) && !Cec_ManSimCompareConst(pRes, p->nWords) )
+        {
+            Vec_IntPush( p->vRefinedC, i );
+            if ( p->pBestState )
+                Cec_ManSimCompareConstScore( pRes, p->nWords, p->pScores );
+        }
+        // if this is the last node of the class, process it
+        if ( Gia_ObjIsTail(p->pAig, i) )
+            Cec_ManSimClassRefineOne( p, Gia_ObjRepr(p->pAig, i) );
+    }
+    if ( p->pPars->fConstCorr )
+    {
+        Vec_IntForEachEntry( p->vRefinedC, i, k )
+            Gia_ObjSetRepr( p->pAig, i, GIA_VOID );
+        Vec_IntClear( p->vRefinedC );
+    }
+    if ( Vec_IntSize(p->vRefinedC) > 0 )
+        Cec_ManSimProcessRefined( p, p->vRefinedC );
+    assert( vInfoCis == NULL || iCiId == Gia_ManCiNum(p->pAig) );
+    assert( vInfoCos == NULL || iCoId == Gia_ManCoNum(p->pAig) );
+    // restore the recycable memory
+    memset( p->pSimInfo, 0, sizeof(int) * Gia_ManObjNum(p->pAig) );
+    p->pMems = pMemsOld;
+    ABC_FREE( pFlat );
+    if ( p->pPars->fVeryVerbose )
+        Gia_ManEquivPrintClasses( p->pAig, 0, Cec_MemUsage(p) );
+    if ( p->pBestState )
+        Cec_ManSimFindBestPattern( p );
+    return Cec_ManSimAnalyzeOutputs( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Simulates one round.]
@@ -654,6 +764,8 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
     Gia_Obj_t * pObj;
     unsigned * pRes0, * pRes1, * pRes;
     int i, k, w, Ent, iCiId = 0, iCoId = 0;
+    if ( p->pPars->nThreads > 1 && (double)2 * (1 + (p->nWords + 1) / 2) * Gia_ManObjNum(p->pAig) < (double)0x7FFFFFFF )
+        return Cec_ManSimSimulateRoundMt( p, vInfoCis, vInfoCos );
     // prepare internal storage
     if ( p->nWordsOld != p->nWords )
         Cec_ManSimMemRelink( p );
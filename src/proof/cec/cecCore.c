@@ -53,6 +53,9 @@ void Cec_ManSatSetDefaultParams( Cec_ParSat_t * p )
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fLearnCls      =       0;  // perform clause learning
+    p->fUseCSat       =       0;  // use circuit-based solver before the CNF-based one
+    p->nCubeVars      =       0;  // the number of cube variables for hard outputs (0 = no cubes)
+    p->nCubeProcs     =       1;  // the number of threads solving the cubes
     p->fVerbose       =       0;  // verbose stats
 }  
 
@@ -80,6 +83,7 @@ void Cec_ManSimSetDefaultParams( Cec_ParSim_t * p )
     p->fDualOut       =       0;  // miter with separate outputs
     p->fConstCorr     =       0;  // consider only constants
     p->fSeqSimulate   =       0;  // performs sequential simulation
+    p->nThreads       =       0;  // the number of simulation threads
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
 } 
@@ -138,6 +142,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fDualOut       =       0;  // miter with separate outputs
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
+    p->fUseCSat       =       0;  // use circuit-based solver before the CNF-based one
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -162,6 +167,9 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
+    p->nCubeVars      =       0;  // the number of cube variables for hard outputs (0 = no cubes)
+    p->nCubeProcs     =       1;  // the number of threads solving the cubes
+    p->nCubeBTLimit   =       0;  // conflict limit for one cube (0 = no limit)
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
@@ -349,6 +357,8 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     // duplicate AIG and transfer equivalence classes
     Gia_ManRandom( 1 );
     pIni = Gia_ManDup(pAig);
+    if ( pPars->vLits )
+        Gia_ManEquivRemapLits( pAig, pPars->vLits );
     pIni->pReprs = pAig->pReprs; pAig->pReprs = NULL;
     pIni->pNexts = pAig->pNexts; pAig->pNexts = NULL;
 
@@ -369,6 +379,8 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     Cec_ManSatSetDefaultParams( pParsSat );
     pParsSat->nBTLimit = pPars->nBTLimit;
     pParsSat->fVerbose = pPars->fVeryVerbose;
+    pParsSat->pTele    = pPars->pTele;
+    pParsSat->fUseCSat = pPars->fUseCSat;
     // simulation patterns
     pPat = Cec_ManPatStart();
     pPat->fVerbose = pPars->fVeryVerbose;
@@ -438,7 +450,9 @@ p->timeSat += Abc_Clock() - clk;
         Gia_ManStop( pSrm );
 
         // update the manager
-        pSim->pAig = p->pAig = Gia_ManEquivReduceAndRemap( pTemp = p->pAig, 0, pParsSim->fDualOut );
+        if ( pPars->vEquivs )
+            Cec_ManWarmCollect( p->pAig, pPars->vLits, pPars->vEquivs );
+        pSim->pAig = p->pAig = Gia_ManEquivReduceAndRemapLits( pTemp = p->pAig, 0, pParsSim->fDualOut, pPars->vLits );
         if ( p->pAig == NULL )
         {
             p->pAig = pTemp;
@@ -502,6 +516,8 @@ p->timeSat += Abc_Clock() - clk;
         }
     }
 finalize:
+    if ( pPars->vEquivs && p->pAig )
+        Cec_ManWarmCollect( p->pAig, pPars->vLits, pPars->vEquivs );
     if ( p->pPars->fVerbose && p->pAig )
     {
         Abc_Print( 1, "NBeg = %d. NEnd = %d. (Gain = %6.2f %%).  RBeg = %d. REnd = %d. (Gain = %6.2f %%).\n", 
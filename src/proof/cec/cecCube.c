@@ -0,0 +1,612 @@
+/**CFile****************************************************************
+
+  FileName    [cecCube.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Cube-and-conquer for hard outputs of the miter.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cecCube.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "aig/gia/giaAig.h"
+#include "sat/cnf/cnf.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The output that could not be solved within the conflict limit is split
+    into 2^K cubes over K variables of its cone.  The candidates are the nodes
+    with many fanouts in the middle of the cone.  Each candidate is scored by
+    the lookahead: both of its values are propagated through the AIG (under
+    the assumption that the output is 1) and the numbers of implied nodes are
+    multiplied.  The K best candidates become the cube variables.
+
+    The cubes are solved as assumptions by incremental SAT solvers (one per
+    thread), which take cubes from a shared counter.  When a cube is UNSAT,
+    the final conflict gives the subset of cube literals responsible for it;
+    the remaining cubes containing this subset are skipped.  The first SAT
+    cube stops all solvers.
+*/
+
+#define CEC_CUBE_MAX  16   // the largest number of cube variables
+
+typedef struct Cec_CubeMan_t_ Cec_CubeMan_t;
+struct Cec_CubeMan_t_
+{
+    int             nSplits;       // the number of cube variables
+    int             pSplits[CEC_CUBE_MAX]; // the SAT variables used for splitting
+    int             nCubes;        // the number of cubes
+    int             iNext;         // the next cube to consider
+    int             nConfLimit;    // the conflict limit for one cube
+    volatile int    fSat;          // a satisfying cube was found (stops the solvers)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;         // the lock of the shared data
+#endif
+    Vec_Int_t *     vCores;        // the UNSAT cores (pairs of mask and value)
+    Vec_Int_t *     vCiVars;       // the SAT variables of the CIs
+    Vec_Int_t *     vModel;        // the values of the CIs
+    // statistics
+    int             nUnsat;        // cubes proved UNSAT
+    int             nUndec;        // cubes that timed out
+    int             nPruned;       // cubes skipped because of the cores
+};
+
+typedef struct Cec_CubeThData_t_ Cec_CubeThData_t;
+struct Cec_CubeThData_t_
+{
+    Cec_CubeMan_t * pMan;          // the shared data
+    sat_solver *    pSat;          // the solver of this thread
+    int             nSolved;       // the number of cubes solved
+    abctime         Time;          // the runtime of this thread
+};
+
+typedef struct Cec_CubeLa_t_ Cec_CubeLa_t;
+struct Cec_CubeLa_t_
+{
+    Gia_Man_t *     pGia;          // the cone
+    char *          pValues;       // the ternary values of the nodes
+    Vec_Int_t *     vTrail;        // the assigned nodes
+    int             iHead;         // the propagation queue head
+};
+
+static inline int  Cec_CubeLitValue( Cec_CubeLa_t * p, int iObj, int fCompl ) { return p->pValues[iObj] == 2 ? 2 : p->pValues[iObj] ^ fCompl; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the value to the node.]
+
+  Description [Returns 0 if the node has the opposite value.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_CubeAssign( Cec_CubeLa_t * p, int iObj, int Value )
+{
+    if ( p->pValues[iObj] != 2 )
+        return p->pValues[iObj] == Value;
+    p->pValues[iObj] = Value;
+    Vec_IntPush( p->vTrail, iObj );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the implications at the AND node.]
+
+  Description [Returns 0 if there is a conflict.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_CubeImplyAnd( Cec_CubeLa_t * p, Gia_Obj_t * pObj )
+{
+    int iObj  = Gia_ObjId( p->pGia, pObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    int Value0 = Cec_CubeLitValue( p, iFan0, Gia_ObjFaninC0(pObj) );
+    int Value1 = Cec_CubeLitValue( p, iFan1, Gia_ObjFaninC1(pObj) );
+    if ( Value0 == 0 || Value1 == 0 )
+    {
+        if ( !Cec_CubeAssign( p, iObj, 0 ) )
+            return 0;
+    }
+    else if ( Value0 == 1 && Value1 == 1 )
+    {
+        if ( !Cec_CubeAssign( p, iObj, 1 ) )
+            return 0;
+    }
+    if ( p->pValues[iObj] == 1 )
+        return Cec_CubeAssign( p, iFan0, !Gia_ObjFaninC0(pObj) ) && Cec_CubeAssign( p, iFan1, !Gia_ObjFaninC1(pObj) );
+    if ( p->pValues[iObj] == 0 && Value0 == 1 )
+        return Cec_CubeAssign( p, iFan1, Gia_ObjFaninC1(pObj) );
+    if ( p->pValues[iObj] == 0 && Value1 == 1 )
+        return Cec_CubeAssign( p, iFan0, Gia_ObjFaninC0(pObj) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the assignments in both directions.]
+
+  Description [Returns 0 if there is a conflict.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_CubePropagate( Cec_CubeLa_t * p )
+{
+    Gia_Obj_t * pObj, * pFanout;
+    int k;
+    for ( ; p->iHead < Vec_IntSize(p->vTrail); p->iHead++ )
+    {
+        pObj = Gia_ManObj( p->pGia, Vec_IntEntry(p->vTrail, p->iHead) );
+        if ( Gia_ObjIsAnd(pObj) && !Cec_CubeImplyAnd( p, pObj ) )
+            return 0;
+        Gia_ObjForEachFanoutStatic( p->pGia, pObj, pFanout, k )
+            if ( Gia_ObjIsAnd(pFanout) && !Cec_CubeImplyAnd( p, pFanout ) )
+                return 0;
+    }
+    return 1;
+}
+static void Cec_CubeUndo( Cec_CubeLa_t * p, int iMark )
+{
+    int i, iObj;
+    Vec_IntForEachEntryStart( p->vTrail, iObj, i, iMark )
+        p->pValues[iObj] = 2;
+    Vec_IntShrink( p->vTrail, iMark );
+    p->iHead = iMark;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of nodes implied by the value.]
+
+  Description [Returns -1 if the value leads to a conflict.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_CubeLookahead( Cec_CubeLa_t * p, int iObj, int Value )
+{
+    int iMark = Vec_IntSize(p->vTrail), nImplied;
+    int RetValue = Cec_CubeAssign( p, iObj, Value ) && Cec_CubePropagate( p );
+    nImplied = Vec_IntSize(p->vTrail) - iMark;
+    Cec_CubeUndo( p, iMark );
+    return RetValue ? nImplied : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the cube variables.]
+
+  Description [Returns the IDs of the selected nodes of the cone, or NULL
+  if the lookahead proved that the output is constant 0.  Only the nodes
+  with SAT variables (pVarNums[Id] >= 0) are considered.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cec_CubeSelectVars( Gia_Man_t * p, int * pVarNums, int nVars )
+{
+    Cec_CubeLa_t La, * pLa = &La;
+    Vec_Int_t * vCands, * vCosts, * vRes;
+    Vec_Wrd_t * vScores;
+    Gia_Obj_t * pObj, * pRoot = Gia_ManCo( p, 0 );
+    int * pPerm, i, k, iObj, n0, n1, LevelMax, nCands, iBest;
+    word Best;
+    // assume that the output is 1
+    pLa->pGia    = p;
+    pLa->pValues = ABC_ALLOC( char, Gia_ManObjNum(p) );
+    memset( pLa->pValues, 2, Gia_ManObjNum(p) );
+    pLa->pValues[0] = 0;
+    pLa->vTrail  = Vec_IntAlloc( 1000 );
+    pLa->iHead   = 0;
+    Gia_ManStaticFanoutStart( p );
+    if ( !Cec_CubeAssign( pLa, Gia_ObjFaninId0p(p, pRoot), !Gia_ObjFaninC0(pRoot) ) || !Cec_CubePropagate( pLa ) )
+    {
+        Gia_ManStaticFanoutStop( p );
+        Vec_IntFree( pLa->vTrail );
+        ABC_FREE( pLa->pValues );
+        return NULL;
+    }
+    // collect the central nodes with many fanouts
+    LevelMax = Gia_ManLevelNum( p );
+    vCands = Vec_IntAlloc( 1000 );
+    vCosts = Vec_IntAlloc( 1000 );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) || pVarNums[i] < 0 || pLa->pValues[i] != 2 || Gia_ObjFanoutNum(p, pObj) < 2 )
+            continue;
+        Vec_IntPush( vCands, i );
+        Vec_IntPush( vCosts, -Gia_ObjFanoutNum(p, pObj) * Abc_MinInt(Gia_ObjLevel(p, pObj) + 1, LevelMax - Gia_ObjLevel(p, pObj) + 1) );
+    }
+    pPerm  = Abc_MergeSortCost( Vec_IntArray(vCosts), Vec_IntSize(vCosts) );
+    nCands = Abc_MinInt( Vec_IntSize(vCands), 32 * nVars );
+    // score them using lookahead
+    vScores = Vec_WrdAlloc( nCands );
+    vRes    = Vec_IntAlloc( nVars );
+    for ( k = 0; k < nCands; k++ )
+    {
+        iObj = Vec_IntEntry( vCands, pPerm[k] );
+        if ( pLa->pValues[iObj] != 2 )
+        {
+            Vec_WrdPush( vScores, 0 );
+            continue;
+        }
+        n0 = Cec_CubeLookahead( pLa, iObj, 0 );
+        n1 = Cec_CubeLookahead( pLa, iObj, 1 );
+        if ( n0 == -1 && n1 == -1 )
+            break;
+        if ( n0 == -1 || n1 == -1 ) // failed literal - the node is implied
+        {
+            if ( !Cec_CubeAssign( pLa, iObj, n0 == -1 ) || !Cec_CubePropagate( pLa ) )
+                break;
+            Vec_WrdPush( vScores, 0 );
+            continue;
+        }
+        Vec_WrdPush( vScores, (word)(n0 + 1) * (word)(n1 + 1) );
+    }
+    if ( k < nCands ) // both values are failed - the output is constant 0
+        Vec_IntFreeP( &vRes );
+    else
+    {
+        // pick the best ones that are still not implied
+        for ( i = 0; i < nVars; i++ )
+        {
+            Best = 0; iBest = -1;
+            for ( k = 0; k < nCands; k++ )
+                if ( Best < Vec_WrdEntry(vScores, k) && pLa->pValues[Vec_IntEntry(vCands, pPerm[k])] == 2 )
+                    Best = Vec_WrdEntry(vScores, k), iBest = k;
+            if ( iBest == -1 )
+                break;
+            Vec_IntPush( vRes, Vec_IntEntry(vCands, pPerm[iBest]) );
+            Vec_WrdWriteEntry( vScores, iBest, 0 );
+        }
+    }
+    Gia_ManStaticFanoutStop( p );
+    ABC_FREE( pPerm );
+    Vec_WrdFree( vScores );
+    Vec_IntFree( vCands );
+    Vec_IntFree( vCosts );
+    Vec_IntFree( pLa->vTrail );
+    ABC_FREE( pLa->pValues );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next cube not covered by the cores.]
+
+  Description [Returns -1 if there are no more cubes to solve.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_CubeNext( Cec_CubeMan_t * p )
+{
+    int iCube, i, Mask, Value;
+    while ( p->iNext < p->nCubes && !p->fSat )
+    {
+        iCube = p->iNext++;
+        Vec_IntForEachEntryDouble( p->vCores, Mask, Value, i )
+            if ( (iCube & Mask) == Value )
+                break;
+        if ( i == Vec_IntSize(p->vCores) )
+            return iCube;
+        p->nPruned++;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the result of solving one cube.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_CubeRecord( Cec_CubeMan_t * p, sat_solver * pSat, int iCube, int status )
+{
+    int i, k, Mask, nFinal, * pFinal;
+    if ( status == l_False )
+    {
+        // find the cube literals responsible for the conflict
+        nFinal = sat_solver_final( pSat, &pFinal );
+        for ( Mask = i = 0; i < nFinal; i++ )
+        {
+            for ( k = 0; k < p->nSplits; k++ )
+                if ( p->pSplits[k] == lit_var(pFinal[i]) )
+                    break;
+            Mask |= (k < p->nSplits) ? (1 << k) : (p->nCubes - 1);
+        }
+        Vec_IntPush( p->vCores, Mask );
+        Vec_IntPush( p->vCores, iCube & Mask );
+        p->nUnsat++;
+    }
+    else if ( status == l_True )
+    {
+        if ( p->fSat )
+            return;
+        p->fSat = 1;
+        Vec_IntClear( p->vModel );
+        Vec_IntForEachEntry( p->vCiVars, k, i )
+            Vec_IntPush( p->vModel, k >= 0 ? sat_solver_var_value(pSat, k) : 0 );
+    }
+    else if ( !p->fSat )
+        p->nUndec++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the assumptions for the cube.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cec_CubeLits( Cec_CubeMan_t * p, int iCube, int * pLits )
+{
+    int i;
+    for ( i = 0; i < p->nSplits; i++ )
+        pLits[i] = toLitCond( p->pSplits[i], !((iCube >> i) & 1) );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+static void Cec_CubeSolveAll( Cec_CubeThData_t * pThData, int nProcs )
+{
+    Cec_CubeMan_t * p = pThData->pMan;
+    int pLits[CEC_CUBE_MAX], iCube, status;
+    abctime clk = Abc_Clock();
+    while ( (iCube = Cec_CubeNext(p)) != -1 )
+    {
+        Cec_CubeLits( p, iCube, pLits );
+        status = sat_solver_solve( pThData->pSat, pLits, pLits + p->nSplits, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+        Cec_CubeRecord( p, pThData->pSat, iCube, status );
+        pThData->nSolved++;
+    }
+    pThData->Time = Abc_Clock() - clk;
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the cubes in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Cec_CubeWorkerThread( void * pArg )
+{
+    Cec_CubeThData_t * pThData = (Cec_CubeThData_t *)pArg;
+    Cec_CubeMan_t * p = pThData->pMan;
+    int pLits[CEC_CUBE_MAX], iCube, status, RetValue;
+    abctime clk = Abc_Clock();
+    while ( 1 )
+    {
+        status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+        iCube = Cec_CubeNext( p );
+        status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+        if ( iCube == -1 )
+            break;
+        Cec_CubeLits( p, iCube, pLits );
+        RetValue = sat_solver_solve( pThData->pSat, pLits, pLits + p->nSplits, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+        pThData->nSolved++;
+        // the first satisfying cube sets p->fSat, which stops the other solvers of this run
+        status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+        Cec_CubeRecord( p, pThData->pSat, iCube, RetValue );
+        status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    }
+    pThData->Time = Abc_Clock() - clk;
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+static void Cec_CubeSolveAll( Cec_CubeThData_t * pThData, int nProcs )
+{
+    Cec_CubeMan_t * p = pThData->pMan;
+    pthread_t * pThreads = ABC_ALLOC( pthread_t, nProcs );
+    int i, status;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pSat->pStop = &p->fSat;
+        status = pthread_create( pThreads + i, NULL, Cec_CubeWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( pThreads );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output of the miter using cube-and-conquer.]
+
+  Description [Returns 1 if the output is constant 0, 0 if it is satisfiable,
+  -1 if undecided.  In the satisfiable case, the counter-example is stored
+  in vCex as literals of the CI numbers (the same as in Cec_ManSatSolveMiter).
+  The conflict limit applies to one cube (0 means no limit). If pTele is
+  not NULL, the statistics of the solvers are added to it (Sat_Tele_t).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSolveCubes( Gia_Man_t * pAig, int iOut, int nCubeVars, int nProcs, int nConfLimit, int fVerbose, Vec_Int_t * vCex, void * pTele )
+{
+    Cec_CubeMan_t Man, * p = &Man;
+    Cec_CubeThData_t * pThData;
+    Gia_Man_t * pCone;
+    Aig_Man_t * pMan;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vSplits;
+    Gia_Obj_t * pObj;
+    int * pVarNums, i, iVar, RetValue = -1;
+    abctime clk = Abc_Clock();
+    assert( nCubeVars > 0 && nProcs > 0 );
+    nCubeVars = Abc_MinInt( nCubeVars, CEC_CUBE_MAX );
+    Vec_IntClear( vCex );
+    if ( Gia_ObjIsConst0(Gia_ObjFanin0(Gia_ManCo(pAig, iOut))) )
+        return !Gia_ObjFaninC0(Gia_ManCo(pAig, iOut));
+    // derive the CNF of the cone
+    pCone = Gia_ManDupDfsCone( pAig, Gia_ManCo(pAig, iOut) );
+    assert( Gia_ManCiNum(pCone) == Gia_ManCiNum(pAig) );
+    pMan  = Gia_ManToAigSimple( pCone );
+    pCnf  = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    pVarNums = ABC_FALLOC( int, Gia_ManObjNum(pCone) );
+    Gia_ManForEachObj( pCone, pObj, i )
+        pVarNums[i] = pCnf->pVarNums[Abc_Lit2Var(pObj->Value)];
+    // select the cube variables
+    vSplits = Cec_CubeSelectVars( pCone, pVarNums, nCubeVars );
+    if ( vSplits == NULL || Vec_IntSize(vSplits) == 0 )
+    {
+        RetValue = vSplits == NULL ? 1 : -1;
+        if ( fVerbose && RetValue == 1 )
+            Abc_Print( 1, "Output %d is proved by the lookahead.\n", iOut );
+        else if ( fVerbose )
+            Abc_Print( 1, "Output %d has no variables to split on.\n", iOut );
+        Vec_IntFreeP( &vSplits );
+        goto finish;
+    }
+    // create the shared data
+    memset( p, 0, sizeof(Cec_CubeMan_t) );
+    p->nSplits = Vec_IntSize(vSplits);
+    Vec_IntForEachEntry( vSplits, iVar, i )
+        p->pSplits[i] = pVarNums[iVar];
+    p->nCubes     = 1 << p->nSplits;
+    p->nConfLimit = nConfLimit;
+    p->vCores     = Vec_IntAlloc( 1000 );
+    p->vCiVars    = Vec_IntAlloc( Gia_ManCiNum(pCone) );
+    p->vModel     = Vec_IntAlloc( Gia_ManCiNum(pCone) );
+    Gia_ManForEachCi( pCone, pObj, i )
+        Vec_IntPush( p->vCiVars, pVarNums[Gia_ObjId(pCone, pObj)] );
+    Vec_IntFree( vSplits );
+    // create one incremental solver for each thread
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    nProcs = Abc_MinInt( nProcs, p->nCubes );
+    pThData = ABC_CALLOC( Cec_CubeThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pMan = p;
+        pThData[i].pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+        if ( pThData[i].pSat == NULL || !Cnf_DataWriteOrClause(pThData[i].pSat, pCnf) )
+            break;
+        pThData[i].pSat->fTelemetry = (pTele != NULL);
+    }
+    if ( i == nProcs )
+    {
+        Cec_CubeSolveAll( pThData, nProcs );
+        RetValue = p->fSat ? 0 : (p->nUndec ? -1 : 1);
+    }
+    else
+        RetValue = 1;
+    if ( RetValue == 0 )
+        Vec_IntForEachEntry( p->vModel, iVar, i )
+            if ( Vec_IntEntry(p->vCiVars, i) >= 0 )
+                Vec_IntPush( vCex, Abc_Var2Lit(i, !iVar) );
+    if ( fVerbose )
+    {
+        // the threads run in parallel, so the slowest one is added
+        abctime clkThread = 0;
+        for ( i = 0; i < nProcs; i++ )
+            if ( clkThread < pThData[i].Time )
+                clkThread = pThData[i].Time;
+        clk -= clkThread;
+        Abc_Print( 1, "Output %5d : Vars = %2d. Cubes = %6d. Unsat = %6d. Pruned = %6d. Undec = %6d. %-12s",
+            iOut, p->nSplits, p->nCubes, p->nUnsat, p->nPruned, p->nUndec,
+            RetValue == 0 ? "Satisfiable" : (RetValue == 1 ? "Proved" : "Undecided") );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        if ( pThData[i].pSat )
+        {
+            if ( pTele )
+                Sat_SolverTeleCollect( pThData[i].pSat, (Sat_Tele_t *)pTele );
+            sat_solver_delete( pThData[i].pSat );
+        }
+    ABC_FREE( pThData );
+    Vec_IntFree( p->vCores );
+    Vec_IntFree( p->vCiVars );
+    Vec_IntFree( p->vModel );
+finish:
+    ABC_FREE( pVarNums );
+    Cnf_DataFree( pCnf );
+    Aig_ManStop( pMan );
+    Gia_ManStop( pCone );
+    return RetValue;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -95,6 +95,7 @@ struct Cec_ManSat_t_
     int              nSatSat;        // the number of failure
     int              nSatUndec;      // the number of timeouts
     int              nSatTotal;      // the number of calls
+    int              nCSatUnsat;     // the number of proofs by the circuit-based solver
     int              nCexLits;
     // conflicts
     int              nConfUnsat;     // conflicts in unsat problems
@@ -104,6 +105,7 @@ struct Cec_ManSat_t_
     int              timeSatUnsat;   // unsat
     int              timeSatSat;     // sat
     int              timeSatUndec;   // undecided
+    int              timeCSat;       // circuit-based solver
     int              timeTotal;      // total runtime
 };
 
@@ -175,6 +177,8 @@ extern int                  Cec_ManSimClassRemoveOne( Cec_ManSim_t * p, int i );
 extern int                  Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int LevelMax );
 extern int                  Cec_ManSimClassesRefine( Cec_ManSim_t * p );
 extern int                  Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos );
+/*=== cecCube.c ============================================================*/
+extern int                  Cec_ManSolveCubes( Gia_Man_t * pAig, int iOut, int nCubeVars, int nProcs, int nConfLimit, int fVerbose, Vec_Int_t * vCex, void * pTele );
 /*=== cecIso.c ============================================================*/
 extern int *                Cec_ManDetectIsomorphism( Gia_Man_t * p );
 /*=== cecMan.c ============================================================*/
@@ -200,6 +204,7 @@ extern int                  Cec_ManCountNonConstOutputs( Gia_Man_t * pAig );
 extern int                  Cec_ManCheckNonTrivialCands( Gia_Man_t * pAig );
 /*=== cecSolve.c ============================================================*/
 extern int                  Cec_ObjSatVarValue( Cec_ManSat_t * p, Gia_Obj_t * pObj );
+extern int                  Cec_ManSatSolveCSat( Gia_Man_t * pAig, Cec_ParSat_t * pPars );
 extern void                 Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars );
 extern Vec_Str_t *          Cec_ManSatSolveSeq( Vec_Ptr_t * vPatts, Gia_Man_t * pAig, Cec_ParSat_t * pPars, int nRegs, int * pnPats );
 extern Vec_Int_t *          Cec_ManSatSolveMiter( Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Str_t ** pvStatus );
@@ -207,6 +212,11 @@ extern int                  Cec_ManSatCheckNode( Cec_ManSat_t * p, Gia_Obj_t * p
 extern int                  Cec_ManSatCheckNodeTwo( Cec_ManSat_t * p, Gia_Obj_t * pObj1, Gia_Obj_t * pObj2 );
 extern void                 Cec_ManSavePattern( Cec_ManSat_t * p, Gia_Obj_t * pObj1, Gia_Obj_t * pObj2 );
 extern Vec_Int_t *          Cec_ManSatReadCex( Cec_ManSat_t * p );
+/*=== cecWarm.c ============================================================*/
+extern Vec_Wrd_t *          Cec_ManWarmSigs( Gia_Man_t * p );
+extern Gia_Man_t *          Cec_ManWarmStart( Gia_Man_t * p, Vec_Wrd_t * vSigs, char * pFileName, Vec_Int_t * vLits, Vec_Int_t * vEquivs, int fVerbose );
+extern void                 Cec_ManWarmCollect( Gia_Man_t * p, Vec_Int_t * vLits, Vec_Int_t * vEquivs );
+extern int                  Cec_ManWarmSave( Vec_Wrd_t * vSigs, Vec_Int_t * vEquivs, char * pFileName, int fVerbose );
 /*=== ceFraeep.c ============================================================*/
 extern Gia_Man_t *          Cec_ManFraSpecReduction( Cec_ManFra_t * p );
 extern int                  Cec_ManFraClassesUpdate( Cec_ManFra_t * p, Cec_ManSim_t * pSim, Cec_ManPat_t * pPat, Gia_Man_t * pNew );
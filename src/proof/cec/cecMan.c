@@ -87,6 +87,12 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
     Abc_Print( 1, "Undef calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUndec, p->nSatTotal? 100.0*p->nSatUndec/p->nSatTotal : 0.0, p->nSatUndec? 1.0*p->nConfUndec/p->nSatUndec : 0.0 );
     Abc_PrintTimeP( 1, "Time", p->timeSatUndec, p->timeTotal );
+    if ( p->pPars->fUseCSat )
+    {
+        Abc_Print( 1, "CSat proofs %6d  (%6.2f %%)                         ", 
+            p->nCSatUnsat, Gia_ManCoNum(p->pAig)? 100.0*p->nCSatUnsat/Gia_ManCoNum(p->pAig) : 0.0 );
+        Abc_PrintTimeP( 1, "Time", p->timeCSat, p->timeTotal );
+    }
     Abc_PrintTime( 1, "Total time", p->timeTotal );
 }
 
@@ -103,6 +109,8 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
 ***********************************************************************/
 void Cec_ManSatStop( Cec_ManSat_t * p )
 {
+    if ( p->pSat && p->pPars->pTele )
+        Sat_SolverTeleCollect( p->pSat, (Sat_Tele_t *)p->pPars->pTele );
     if ( p->pSat )
         sat_solver_delete( p->pSat );
     Vec_IntFree( p->vCex );
@@ -373,9 +373,12 @@ void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
             Cec_ObjSetSatNum( p, pObj, 0 );
         Vec_PtrClear( p->vUsedNodes );
 //        memset( p->pSatVars, 0, sizeof(int) * Gia_ManObjNumMax(p->pAigTotal) );
+        if ( p->pPars->pTele )
+            Sat_SolverTeleCollect( p->pSat, (Sat_Tele_t *)p->pPars->pTele );
         sat_solver_delete( p->pSat );
     }
     p->pSat = sat_solver_new();
+    p->pSat->fTelemetry = (p->pPars->pTele != NULL);
     sat_solver_setnvars( p->pSat, 1000 );
     p->pSat->factors = ABC_CALLOC( double, p->pSat->cap );
     // var 0 is not used
@@ -661,6 +664,58 @@ p->timeSatUndec += Abc_Clock() - clk;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the POs of the AIG using the circuit-based solver.]
+
+  Description [Marks the POs proved by the circuit-based solver with
+  fMark1. The learned clauses are kept across the calls, so that the
+  proofs of the earlier outputs speed up the later ones. The outputs,
+  which are not proved, are left for the CNF-based solver, which also
+  derives the patterns used for refinement. Returns the number of POs
+  proved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSatSolveCSat( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
+{
+    Tas_Man_t * pTas;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vValues;
+    Vec_Str_t * vStatus;
+    int i, fHadRefs = (pAig->pRefs != NULL), nProved = 0;
+    // save the values because the solver uses them as trail IDs
+    vValues = Vec_IntAlloc( Gia_ManObjNum(pAig) );
+    Gia_ManForEachObj( pAig, pObj, i )
+        Vec_IntPush( vValues, pObj->Value );
+    Gia_ManCreateRefs( pAig );
+    Gia_ManCleanMark0( pAig );
+    Gia_ManCleanMark1( pAig );
+    Gia_ManFillValue( pAig );
+    Gia_ManCleanPhase( pAig );
+    pTas = Tas_ManAlloc( pAig, pPars->nBTLimit );
+    Tas_ManSetLearning( pTas, 1 << 20, 8 );
+    vStatus = Vec_StrStart( Gia_ManCoNum(pAig) );
+    Gia_ManForEachCo( pAig, pObj, i )
+        if ( !Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) && Tas_ManSolve(pTas, Gia_ObjChild0(pObj), NULL) == 1 )
+            Vec_StrWriteEntry( vStatus, i, 1 );
+    Tas_ManStop( pTas );
+    // restore the manager
+    Gia_ManForEachObj( pAig, pObj, i )
+        pObj->Value = Vec_IntEntry( vValues, i );
+    Gia_ManForEachCo( pAig, pObj, i )
+        if ( (pObj->fMark1 = Vec_StrEntry(vStatus, i)) )
+            nProved++;
+    if ( !fHadRefs )
+        ABC_FREE( pAig->pRefs );
+    Vec_StrFree( vStatus );
+    Vec_IntFree( vValues );
+    return nProved;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of solving for the POs of the AIG.]
@@ -678,8 +733,8 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
     Bar_Progress_t * pProgress = NULL;
     Cec_ManSat_t * p;
     Gia_Obj_t * pObj;
-    int i, status;
-    abctime clk = Abc_Clock(), clk2;
+    int i, status, nCSatUnsat = 0;
+    abctime clk = Abc_Clock(), clk2, clkCSat = 0;
     // reset the manager
     if ( pPat )
     {
@@ -688,10 +743,19 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
         pPat->nPatLits = 0;
         pPat->nPatLitsMin = 0;
     } 
+    // try the circuit-based solver first
+    if ( pPars->fUseCSat )
+    {
+        clkCSat = Abc_Clock();
+        nCSatUnsat = Cec_ManSatSolveCSat( pAig, pPars );
+        clkCSat = Abc_Clock() - clkCSat;
+    }
     Gia_ManSetPhase( pAig );
     Gia_ManLevelNum( pAig );
     Gia_ManIncrementTravId( pAig );
     p = Cec_ManSatCreate( pAig, pPars );
+    p->nCSatUnsat = nCSatUnsat;
+    p->timeCSat   = (int)clkCSat;
     pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
     Gia_ManForEachCo( pAig, pObj, i )
     {
@@ -701,9 +765,25 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
             pObj->fMark1 = 1;
             continue;
         }
+        if ( pPars->fUseCSat && pObj->fMark1 )
+        {
+            pObj->fMark0 = 0;
+            continue;
+        }
         Bar_ProgressUpdate( pProgress, i, "SAT..." );
 clk2 = Abc_Clock();
         status = Cec_ManSatCheckNode( p, Gia_ObjChild0(pObj) );
+        if ( status == -1 && pPars->nCubeVars )
+        {
+            // split the hard output into cubes
+            status = Cec_ManSolveCubes( pAig, i, pPars->nCubeVars, pPars->nCubeProcs, pPars->nBTLimit, pPars->fVerbose, p->vCex, pPars->pTele );
+            pObj->fMark0 = (status == 0);
+            pObj->fMark1 = (status == 1);
+            // the pattern is not saved because the SAT solver does not have it
+            if ( status == 0 && pPars->fCheckMiter )
+                break;
+            continue;
+        }
         pObj->fMark0 = (status == 0);
         pObj->fMark1 = (status == 1);
 /*
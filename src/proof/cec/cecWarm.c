@@ -0,0 +1,426 @@
+/**CFile****************************************************************
+
+  FileName    [cecWarm.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Warm-start of CEC using equivalences proved in the previous run.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cecWarm.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "misc/extra/extra.h"
+#include "misc/vec/vecWec.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the number of simulation words used to validate the loaded classes
+#define CEC_WARM_WORDS 8
+
+static inline word Cec_WarmMix( word x )
+{
+    x += ABC_CONST(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+
+static inline int Cec_WarmFind( Vec_Int_t * vEquivs, int i )
+{
+    while ( Vec_IntEntry(vEquivs, i) != i )
+    {
+        Vec_IntWriteEntry( vEquivs, i, Vec_IntEntry(vEquivs, Vec_IntEntry(vEquivs, i)) );
+        i = Vec_IntEntry( vEquivs, i );
+    }
+    return i;
+}
+static inline void Cec_WarmUnion( Vec_Int_t * vEquivs, int i, int k )
+{
+    i = Cec_WarmFind( vEquivs, i );
+    k = Cec_WarmFind( vEquivs, k );
+    if ( i < k )
+        Vec_IntWriteEntry( vEquivs, k, i );
+    else if ( k < i )
+        Vec_IntWriteEntry( vEquivs, i, k );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes structural signatures of the objects.]
+
+  Description [The signature of a node depends only on the structure of
+  its fanin cone and the indexes of the combinational inputs in it, but
+  not on the object IDs, so the signature of a logic cone is preserved
+  when the unrelated parts of the design are modified. The signatures
+  of the combinational outputs are set to 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Cec_ManWarmSigs( Gia_Man_t * p )
+{
+    Vec_Wrd_t * vSigs;
+    Gia_Obj_t * pObj;
+    word Sig0, Sig1;
+    int i;
+    vSigs = Vec_WrdStart( Gia_ManObjNum(p) );
+    Vec_WrdWriteEntry( vSigs, 0, Cec_WarmMix(1) );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            Vec_WrdWriteEntry( vSigs, i, Cec_WarmMix(((word)Gia_ObjCioId(pObj) << 2) | 2) );
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            Sig0 = Cec_WarmMix( Vec_WrdEntry(vSigs, Gia_ObjFaninId0(pObj, i)) ^ Gia_ObjFaninC0(pObj) );
+            Sig1 = Cec_WarmMix( Vec_WrdEntry(vSigs, Gia_ObjFaninId1(pObj, i)) ^ Gia_ObjFaninC1(pObj) );
+            if ( Sig0 > Sig1 )
+                ABC_SWAP( word, Sig0, Sig1 );
+            Vec_WrdWriteEntry( vSigs, i, Cec_WarmMix(Sig0 ^ Cec_WarmMix(Sig1 + 3)) );
+        }
+    }
+    return vSigs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs random simulation of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Wrd_t * Cec_ManWarmSimulate( Gia_Man_t * p )
+{
+    Vec_Wrd_t * vSims;
+    Gia_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    int i, w;
+    vSims = Vec_WrdStart( CEC_WARM_WORDS * Gia_ManObjNum(p) );
+    Gia_ManRandom( 1 );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        pSim = Vec_WrdEntryP( vSims, CEC_WARM_WORDS * i );
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            for ( w = 0; w < CEC_WARM_WORDS; w++ )
+                pSim[w] = ((word)Gia_ManRandom(0) << 32) | (word)Gia_ManRandom(0);
+        }
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            pSim0 = Vec_WrdEntryP( vSims, CEC_WARM_WORDS * Gia_ObjFaninId0(pObj, i) );
+            pSim1 = Vec_WrdEntryP( vSims, CEC_WARM_WORDS * Gia_ObjFaninId1(pObj, i) );
+            for ( w = 0; w < CEC_WARM_WORDS; w++ )
+                pSim[w] = (Gia_ObjFaninC0(pObj) ? ~pSim0[w] : pSim0[w]) & (Gia_ObjFaninC1(pObj) ? ~pSim1[w] : pSim1[w]);
+        }
+    }
+    return vSims;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two objects have equal or opposite simulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManWarmSimEqual( Vec_Wrd_t * vSims, int iObj0, int iObj1 )
+{
+    word * pSim0 = Vec_WrdEntryP( vSims, CEC_WARM_WORDS * iObj0 );
+    word * pSim1 = Vec_WrdEntryP( vSims, CEC_WARM_WORDS * iObj1 );
+    int w, fCompl = (int)((pSim0[0] ^ pSim1[0]) & 1);
+    for ( w = 0; w < CEC_WARM_WORDS; w++ )
+        if ( pSim0[w] != (fCompl ? ~pSim1[w] : pSim1[w]) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes the signatures.]
+
+  Description [Returns the table with open addressing, which contains
+  the object IDs and -1 for empty slots. The signatures shared by several
+  objects are not used for seeding; their entries are (-2 - ID), where
+  ID is the first of these objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cec_ManWarmHash( Vec_Wrd_t * vSigs, int * pMask )
+{
+    Vec_Int_t * vTable;
+    word Sig;
+    int i, Mask, Key, Entry;
+    Mask = (1 << Abc_Base2Log(2 * Vec_WrdSize(vSigs) + 1)) - 1;
+    vTable = Vec_IntStartFull( Mask + 1 );
+    Vec_WrdForEachEntry( vSigs, Sig, i )
+    {
+        if ( Sig == 0 )
+            continue;
+        for ( Key = (int)(Sig & Mask); (Entry = Vec_IntEntry(vTable, Key)) != -1; Key = (Key + 1) & Mask )
+            if ( Vec_WrdEntry(vSigs, Entry >= 0 ? Entry : -2 - Entry) == Sig )
+                break;
+        if ( Entry == -1 )
+            Vec_IntWriteEntry( vTable, Key, i );
+        else if ( Entry >= 0 )
+            Vec_IntWriteEntry( vTable, Key, -2 - Entry );
+    }
+    *pMask = Mask;
+    return vTable;
+}
+static int Cec_ManWarmLookup( Vec_Wrd_t * vSigs, Vec_Int_t * vTable, int Mask, word Sig )
+{
+    int Key, Entry;
+    for ( Key = (int)(Sig & Mask); (Entry = Vec_IntEntry(vTable, Key)) != -1; Key = (Key + 1) & Mask )
+        if ( Vec_WrdEntry(vSigs, Entry >= 0 ? Entry : -2 - Entry) == Sig )
+            return Entry >= 0 ? Entry : -1;
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Seeds the equivalence classes loaded from file.]
+
+  Description [The file lists the classes of equivalent nodes, one class
+  per line, each node given by its structural signature. The classes are
+  mapped into the current AIG using signatures, then checked by random
+  simulation and used to reduce the AIG. Returns the reduced AIG, or NULL
+  if nothing could be seeded. On return, vLits maps objects of p into
+  literals of the resulting AIG (or -1 if they are dropped) and vEquivs
+  (the union-find array over the objects of p) records the seeded classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ManWarmStart( Gia_Man_t * p, Vec_Wrd_t * vSigs, char * pFileName, Vec_Int_t * vLits, Vec_Int_t * vEquivs, int fVerbose )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Vec_Int_t * vTable, * vClass;
+    Vec_Wrd_t * vSims;
+    char * pContents, * pCur, * pEnd;
+    int i, k, iObj, iRepr, Mask;
+    int nClasses = 0, nLoaded = 0, nSeeded = 0, nFailed = 0;
+    abctime clk = Abc_Clock();
+    assert( p->pReprs == NULL );
+    assert( Vec_WrdSize(vSigs) == Gia_ManObjNum(p) );
+    Vec_IntClear( vLits );
+    Vec_IntClear( vEquivs );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        Vec_IntPush( vLits, Abc_Var2Lit(i, 0) );
+        Vec_IntPush( vEquivs, i );
+    }
+    pContents = Extra_FileReadContents( pFileName );
+    if ( pContents == NULL )
+    {
+        if ( fVerbose )
+            Abc_Print( 1, "Warm-start file \"%s\" is not available.\n", pFileName );
+        return NULL;
+    }
+    // start the classes
+    p->pReprs = ABC_CALLOC( Gia_Rpr_t, Gia_ManObjNum(p) );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        Gia_ObjSetRepr( p, i, GIA_VOID );
+    vTable = Cec_ManWarmHash( vSigs, &Mask );
+    vSims  = Cec_ManWarmSimulate( p );
+    vClass = Vec_IntAlloc( 100 );
+    Gia_ManCleanMark0( p );
+    for ( pCur = pContents; *pCur; )
+    {
+        // skip comments
+        if ( *pCur == '#' )
+        {
+            while ( *pCur && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        // collect the nodes of one class
+        Vec_IntClear( vClass );
+        while ( *pCur && *pCur != '\n' )
+        {
+            word Sig = strtoull( pCur, &pEnd, 16 );
+            if ( pEnd == pCur )
+            {
+                pCur++;
+                continue;
+            }
+            pCur = pEnd;
+            nLoaded++;
+            iObj = Cec_ManWarmLookup( vSigs, vTable, Mask, Sig );
+            if ( iObj < 0 || Gia_ObjIsCo(Gia_ManObj(p, iObj)) || Gia_ManObj(p, iObj)->fMark0 )
+                continue;
+            Gia_ManObj(p, iObj)->fMark0 = 1;
+            Vec_IntPush( vClass, iObj );
+        }
+        if ( *pCur == '\n' )
+            pCur++;
+        if ( Vec_IntSize(vClass) < 2 )
+            continue;
+        // the smallest ID is the representative
+        Vec_IntSort( vClass, 0 );
+        iRepr = Vec_IntEntry( vClass, 0 );
+        Vec_IntForEachEntryStart( vClass, iObj, k, 1 )
+        {
+            if ( Gia_ObjIsCi(Gia_ManObj(p, iObj)) || !Cec_ManWarmSimEqual(vSims, iRepr, iObj) )
+            {
+                nFailed++;
+                continue;
+            }
+            Gia_ObjSetRepr( p, iObj, iRepr );
+            Gia_ObjSetProved( p, iObj );
+            Cec_WarmUnion( vEquivs, iRepr, iObj );
+            nSeeded++;
+        }
+        nClasses++;
+    }
+    Gia_ManCleanMark0( p );
+    Vec_IntFree( vClass );
+    Vec_WrdFree( vSims );
+    Vec_IntFree( vTable );
+    ABC_FREE( pContents );
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Warm-start: Loaded %d nodes. Matched %d classes. Seeded %d equivalences. Rejected %d.  ",
+            nLoaded, nClasses, nSeeded, nFailed );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( nSeeded == 0 )
+    {
+        ABC_FREE( p->pReprs );
+        return NULL;
+    }
+    // reduce the AIG using the seeded classes
+    p->pNexts = Gia_ManDeriveNexts( p );
+    pNew = Gia_ManEquivReduce( p, 0, 0, 0, 0 );
+    assert( pNew != NULL );
+    Gia_ManEquivRemapLits( p, vLits );
+    Gia_ManEquivFixOutputPairs( pNew );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManEquivRemapLits( pTemp, vLits );
+    Gia_ManStop( pTemp );
+    ABC_FREE( p->pReprs );
+    ABC_FREE( p->pNexts );
+    if ( fVerbose )
+        Abc_Print( 1, "Warm-start: Reduced AIG from %d to %d nodes.\n", Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the proved equivalences.]
+
+  Description [Objects of the input AIG, whose literals in vLits point to
+  the same object of p, or to the objects of p proved equivalent, are
+  merged in the union-find array vEquivs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManWarmCollect( Gia_Man_t * p, Vec_Int_t * vLits, Vec_Int_t * vEquivs )
+{
+    Vec_Int_t * vFirst;
+    int i, iLit, iObj;
+    vFirst = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_IntForEachEntry( vLits, iLit, i )
+    {
+        if ( iLit < 0 )
+            continue;
+        iObj = Abc_Lit2Var( iLit );
+        if ( p->pReprs && Gia_ObjHasRepr(p, iObj) && Gia_ObjProved(p, iObj) )
+            iObj = Gia_ObjRepr( p, iObj );
+        if ( Vec_IntEntry(vFirst, iObj) == -1 )
+            Vec_IntWriteEntry( vFirst, iObj, i );
+        else
+            Cec_WarmUnion( vEquivs, Vec_IntEntry(vFirst, iObj), i );
+    }
+    Vec_IntFree( vFirst );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the proved equivalence classes into file.]
+
+  Description [Returns the number of classes written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManWarmSave( Vec_Wrd_t * vSigs, Vec_Int_t * vEquivs, char * pFileName, int fVerbose )
+{
+    FILE * pFile;
+    Vec_Wec_t * vClasses;
+    Vec_Int_t * vClass;
+    int i, k, iRoot, nClasses = 0, nNodes = 0;
+    assert( Vec_WrdSize(vSigs) == Vec_IntSize(vEquivs) );
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open warm-start file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    // collect the nodes of each class in one pass
+    vClasses = Vec_WecStart( Vec_IntSize(vEquivs) );
+    for ( i = 0; i < Vec_IntSize(vEquivs); i++ )
+        if ( Vec_WrdEntry(vSigs, i) )
+            Vec_WecPush( vClasses, Cec_WarmFind(vEquivs, i), i );
+    fprintf( pFile, "# Equivalence classes proved by ABC (one class per line, nodes given by structural signatures)\n" );
+    Vec_WecForEachLevel( vClasses, vClass, iRoot )
+    {
+        if ( Vec_IntSize(vClass) < 2 )
+            continue;
+        Vec_IntForEachEntry( vClass, i, k )
+            fprintf( pFile, "%s%08x%08x", k ? " " : "", (unsigned)(Vec_WrdEntry(vSigs, i) >> 32), (unsigned)Vec_WrdEntry(vSigs, i) );
+        fprintf( pFile, "\n" );
+        nNodes += Vec_IntSize( vClass );
+        nClasses++;
+    }
+    fclose( pFile );
+    Vec_WecFree( vClasses );
+    if ( fVerbose )
+        Abc_Print( 1, "Warm-start: Saved %d classes with %d nodes into file \"%s\".\n", nClasses, nNodes, pFileName );
+    return nClasses;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -33,6 +33,31 @@ ABC_NAMESPACE_IMPL_START
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Simplifies the CNF of the miter before solving.]
+
+  Description [The CI and CO variables are frozen, so that the model
+  can be read from the CIs and the output clauses can be added later.
+  Returns 0 if the CNF is found UNSAT.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fra_FraigSatSimplify( Cnf_Dat_t * pCnf, Aig_Man_t * pMan, int fVerbose )
+{
+    Cnf_SimpPars_t Pars, * pPars = &Pars;
+    Vec_Int_t * vFrozen = Cnf_DataCollectFrozen( pCnf, pMan );
+    int RetValue;
+    Cnf_SimpSetDefaultParams( pPars );
+    pPars->fVerbose = fVerbose;
+    RetValue = Cnf_DataSimplify( pCnf, vFrozen, pPars );
+    Vec_IntFree( vFrozen );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -46,6 +71,12 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fAndOuts, int fNewSolver, int fVerbose )
 {
+    return Fra_FraigSatInt( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fFlipBits, fAndOuts, fNewSolver, 0, 1, fVerbose, NULL );
+}
+int Fra_FraigSatInt( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fAndOuts, int fNewSolver, int fSimplify, int nProcs, int fVerbose, void * pTele )
+{
+    if ( nProcs > 1 && !fAndOuts && !fNewSolver )
+        return Fra_FraigSatPortfolio( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fFlipBits, fSimplify, nProcs, fVerbose, pTele );
     if ( fNewSolver )
     {
         extern void * Cnf_DataWriteIntoSolver2( Cnf_Dat_t * p, int nFrames, int fInit );
@@ -67,6 +98,13 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         if ( fFlipBits ) 
             Cnf_DataTranformPolarity( pCnf, 0 );
 
+        // simplify the CNF
+        if ( fSimplify && !Fra_FraigSatSimplify( pCnf, pMan, fVerbose ) )
+        {
+            Cnf_DataFree( pCnf );
+            return 1;
+        }
+
         // convert into SAT solver
         pSat = (sat_solver2 *)Cnf_DataWriteIntoSolver2( pCnf, 1, 0 );
         if ( pSat == NULL )
@@ -119,6 +157,7 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         clk = Abc_Clock();
         if ( fVerbose )
             pSat->verbosity = 1;
+        pSat->fTelemetry = (pTele != NULL);
         status = sat_solver2_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0 );
         if ( status == l_Undef )
         {
@@ -149,6 +188,8 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         // free the sat_solver2
         if ( fVerbose )
             Sat_Solver2PrintStats( stdout, pSat );
+        if ( pTele )
+            Sat_Solver2TeleCollect( pSat, (Sat_Tele_t *)pTele );
     //sat_solver2_store_write( pSat, "trace.cnf" );
     //sat_solver2_store_free( pSat );
         sat_solver2_delete( pSat );
@@ -173,6 +214,13 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         if ( fFlipBits ) 
             Cnf_DataTranformPolarity( pCnf, 0 );
 
+        // simplify the CNF
+        if ( fSimplify && !Fra_FraigSatSimplify( pCnf, pMan, fVerbose ) )
+        {
+            Cnf_DataFree( pCnf );
+            return 1;
+        }
+
         // convert into SAT solver
         pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
         if ( pSat == NULL )
@@ -234,6 +282,7 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         clk = Abc_Clock();
 //        if ( fVerbose )
 //            pSat->verbosity = 1;
+        pSat->fTelemetry = (pTele != NULL);
         status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0 );
         if ( status == l_Undef )
         {
@@ -264,6 +313,8 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         // free the sat_solver
         if ( fVerbose )
             Sat_SolverPrintStats( stdout, pSat );
+        if ( pTele )
+            Sat_SolverTeleCollect( pSat, (Sat_Tele_t *)pTele );
     //sat_solver_store_write( pSat, "trace.cnf" );
     //sat_solver_store_free( pSat );
         sat_solver_delete( pSat );
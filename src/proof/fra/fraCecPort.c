@@ -0,0 +1,422 @@
+/**CFile****************************************************************
+
+  FileName    [fraCecPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [New FRAIG package.]
+
+  Synopsis    [Portfolio of SAT solvers sharing learned clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 30, 2007.]
+
+  Revision    [$Id: fraCecPort.c,v 1.00 2007/06/30 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "fra.h"
+#include "sat/cnf/cnf.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#ifdef _MSC_VER
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    Each thread runs its own copy of sat_solver on the same CNF.  The solvers
+    differ in the random seed, the restart schedule (Luby or geometric),
+    the restart base, and the initial polarity of the variables.  Units and
+    learned clauses with LBD <= 2 are published into a ring buffer shared by
+    all threads, and each solver picks up the clauses of the other solvers
+    at every restart.  The buffer is lossy: a clause may be overwritten before
+    a slow reader gets to it, or dropped if its slot is being written.
+    Each slot is protected by a version counter (odd while being written),
+    so that writers claim slots with one compare-and-swap and readers discard
+    the copies that were changed while being read.  The first solver that
+    finds the answer stops the others.
+*/
+
+#define FRA_PORT_SLOTS  (1 << 14)  // the number of slots in the ring buffer
+#define FRA_PORT_LITS   12         // the largest shared clause
+
+typedef struct Fra_PortSlot_t_ Fra_PortSlot_t;
+struct Fra_PortSlot_t_
+{
+    volatile word   Version;       // even when stable; odd when being written
+    volatile word   Pos;           // the position in the ring this slot was written for
+    int             iThread;       // the thread that wrote the clause
+    int             nLits;         // the number of literals
+    int             pLits[FRA_PORT_LITS]; // the literals
+};
+
+typedef struct Fra_PortRing_t_ Fra_PortRing_t;
+struct Fra_PortRing_t_
+{
+    Fra_PortSlot_t *pSlots;        // the slots
+    volatile word   iWrite;        // the next position to write
+    volatile word   iWinner;       // 1 + the thread that produced the verdict (0 if none yet)
+    volatile int    fStop;         // set when the verdict is known to stop this run
+};
+
+// information given to the thread
+typedef struct Fra_PortThData_t_ Fra_PortThData_t;
+struct Fra_PortThData_t_
+{
+    sat_solver *    pSat;          // the solver of this thread
+    Fra_PortRing_t *pRing;         // the shared clauses
+    word            iRead;         // the next position to read
+    int             iThread;       // the thread number
+    ABC_INT64_T     nConfLimit;    // conflict limit
+    ABC_INT64_T     nInsLimit;     // propagation limit
+    int             Status;        // l_True, l_False or l_Undef
+    int             fWinner;       // set to 1 if this thread produced the verdict
+    int             nExported;     // the number of clauses exported
+    int             nImported;     // the number of clauses imported
+    abctime         Time;          // runtime of this thread
+};
+
+static inline word Fra_PortFetchAdd( volatile word * p, word Value )
+{
+#ifdef _MSC_VER
+    return (word)InterlockedExchangeAdd64( (volatile LONG64 *)p, (LONG64)Value );
+#else
+    return __sync_fetch_and_add( p, Value );
+#endif
+}
+static inline int Fra_PortCompareSwap( volatile word * p, word Old, word New )
+{
+#ifdef _MSC_VER
+    return (word)InterlockedCompareExchange64( (volatile LONG64 *)p, (LONG64)New, (LONG64)Old ) == Old;
+#else
+    return __sync_bool_compare_and_swap( p, Old, New );
+#endif
+}
+static inline void Fra_PortBarrier()
+{
+#ifdef _MSC_VER
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Diversifies the solver of the given thread.]
+
+  Description [Thread 0 keeps the default configuration.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fra_PortConfigure( sat_solver * pSat, int iThread )
+{
+    static int pBases[4] = { 100, 50, 200, 400 };
+    int v, Mode = (iThread >> 1) % 3;
+    if ( iThread == 0 )
+        return;
+    pSat->random_seed  = 91648253 + 7919 * iThread;
+    pSat->fGeomRestart = iThread & 1;
+    pSat->nRestartBase = pBases[(iThread >> 1) & 3];
+    // initial polarity: 0 = all negative, 1 = all positive, 2 = random
+    for ( v = 0; v < pSat->size; v++ )
+        pSat->polarity[v] = Mode == 0 ? 0 : Mode == 1 ? 1 : (char)(Aig_ManRandom(0) & 1);
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Fra_FraigSatPortfolio( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fSimplify, int nProcs, int fVerbose, void * pTele )
+{
+    return Fra_FraigSatInt( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fFlipBits, 0, 0, fSimplify, 1, fVerbose, pTele );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one solver of the portfolio.]
+
+  Description [Long clauses are not shared.  The clause is dropped if
+  its slot is being written by another thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fra_PortExport( void * pData, lit * pBeg, lit * pEnd )
+{
+    Fra_PortThData_t * p = (Fra_PortThData_t *)pData;
+    Fra_PortSlot_t * pSlot;
+    word Pos, Version;
+    int i, nLits = pEnd - pBeg;
+    if ( nLits > FRA_PORT_LITS )
+        return;
+    Pos     = Fra_PortFetchAdd( &p->pRing->iWrite, 1 );
+    pSlot   = p->pRing->pSlots + (Pos & (FRA_PORT_SLOTS - 1));
+    Version = pSlot->Version;
+    if ( (Version & 1) || !Fra_PortCompareSwap( &pSlot->Version, Version, Version + 1 ) )
+        return;
+    pSlot->Pos     = Pos;
+    pSlot->iThread = p->iThread;
+    pSlot->nLits   = nLits;
+    for ( i = 0; i < nLits; i++ )
+        pSlot->pLits[i] = pBeg[i];
+    Fra_PortBarrier();
+    pSlot->Version = Version + 2;
+    p->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Picks up one clause published by other threads.]
+
+  Description [Returns 0 if there are no more clauses to read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fra_PortImport( void * pData, veci * vLits )
+{
+    Fra_PortThData_t * p = (Fra_PortThData_t *)pData;
+    Fra_PortSlot_t * pSlot, Copy;
+    word iWrite = p->pRing->iWrite, Version;
+    int i;
+    // skip the clauses that were overwritten
+    if ( iWrite - p->iRead > FRA_PORT_SLOTS )
+        p->iRead = iWrite - FRA_PORT_SLOTS;
+    for ( ; p->iRead < iWrite; p->iRead++ )
+    {
+        pSlot   = p->pRing->pSlots + (p->iRead & (FRA_PORT_SLOTS - 1));
+        Version = pSlot->Version;
+        if ( Version & 1 )
+            continue;
+        Fra_PortBarrier();
+        Copy.Pos     = pSlot->Pos;
+        Copy.iThread = pSlot->iThread;
+        Copy.nLits   = pSlot->nLits;
+        for ( i = 0; i < Copy.nLits && i < FRA_PORT_LITS; i++ )
+            Copy.pLits[i] = pSlot->pLits[i];
+        Fra_PortBarrier();
+        if ( pSlot->Version != Version || Copy.Pos != p->iRead || Copy.iThread == p->iThread )
+            continue;
+        veci_resize( vLits, 0 );
+        for ( i = 0; i < Copy.nLits; i++ )
+            veci_push( vLits, Copy.pLits[i] );
+        p->iRead++;
+        p->nImported++;
+        return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one solver of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Fra_PortWorkerThread( void * pArg )
+{
+    Fra_PortThData_t * p = (Fra_PortThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    p->Status = sat_solver_solve( p->pSat, NULL, NULL, p->nConfLimit, p->nInsLimit, 0, 0 );
+    // the first solver to deliver a verdict cancels the other solvers of this run
+    if ( p->Status != l_Undef && Fra_PortCompareSwap( &p->pRing->iWinner, 0, (word)(p->iThread + 1) ) )
+    {
+        p->fWinner = 1;
+        p->pRing->fStop = 1;
+    }
+    p->Time = Abc_Clock() - clk;
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter using a portfolio of SAT solvers.]
+
+  Description [Returns 1 if the miter is UNSAT, 0 if SAT (the model
+  of the CIs is stored in pMan->pData), -1 if undecided.  The outputs
+  of the miter are ORed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSatPortfolio( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fSimplify, int nProcs, int fVerbose, void * pTele )
+{
+    Fra_PortThData_t * pThData;
+    Fra_PortRing_t Ring;
+    pthread_t * pThreads;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vCiIds;
+    abctime clk = Abc_Clock();
+    int i, status, RetValue = -1;
+    assert( Aig_ManRegNum(pMan) == 0 );
+    assert( nProcs > 0 );
+    pMan->pData = NULL;
+
+    // derive CNF
+    pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    if ( fFlipBits )
+        Cnf_DataTranformPolarity( pCnf, 0 );
+    if ( fSimplify )
+    {
+        Vec_Int_t * vFrozen = Cnf_DataCollectFrozen( pCnf, pMan );
+        int RetSimp = Cnf_DataSimplify( pCnf, vFrozen, NULL );
+        Vec_IntFree( vFrozen );
+        if ( !RetSimp )
+        {
+            Cnf_DataFree( pCnf );
+            return 1;
+        }
+    }
+    vCiIds = Cnf_DataCollectPiSatNums( pCnf, pMan );
+
+    // create the solvers (each thread works on its own copy of the CNF)
+    Ring.pSlots = ABC_CALLOC( Fra_PortSlot_t, FRA_PORT_SLOTS );
+    Ring.iWrite = 0;
+    Ring.iWinner = 0;
+    Ring.fStop = 0;
+    pThData  = ABC_CALLOC( Fra_PortThData_t, nProcs );
+    pThreads = ABC_ALLOC( pthread_t, nProcs );
+    Aig_ManRandom( 1 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+        if ( pSat == NULL )
+        {
+            RetValue = 1;
+            break;
+        }
+        if ( !Cnf_DataWriteOrClause(pSat, pCnf) || !sat_solver_simplify(pSat) )
+        {
+            sat_solver_delete( pSat );
+            RetValue = 1;
+            break;
+        }
+        if ( nLearnedStart )
+            pSat->nLearntStart = nLearnedStart;
+        if ( nLearnedDelta )
+            pSat->nLearntDelta = nLearnedDelta;
+        if ( nLearnedPerce )
+            pSat->nLearntRatio = nLearnedPerce;
+        Fra_PortConfigure( pSat, i );
+        pSat->pStop        = &Ring.fStop;
+        pSat->pShareData   = pThData + i;
+        pSat->pFuncExport  = Fra_PortExport;
+        pSat->pFuncImport  = Fra_PortImport;
+        pSat->fTelemetry   = (pTele != NULL);
+        pThData[i].pSat       = pSat;
+        pThData[i].pRing      = &Ring;
+        pThData[i].iThread    = i;
+        pThData[i].nConfLimit = nConfLimit;
+        pThData[i].nInsLimit  = nInsLimit;
+        pThData[i].Status     = l_Undef;
+    }
+    Cnf_DataFree( pCnf );
+    if ( RetValue == 1 )
+    {
+        for ( i = 0; i < nProcs; i++ )
+            if ( pThData[i].pSat )
+                sat_solver_delete( pThData[i].pSat );
+        ABC_FREE( pThreads );
+        ABC_FREE( pThData );
+        ABC_FREE( Ring.pSlots );
+        Vec_IntFree( vCiIds );
+        return 1;
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Running %d solvers on the problem with %d variables and %d clauses.  ",
+            nProcs, sat_solver_nvars(pThData[0].pSat), sat_solver_nclauses(pThData[0].pSat) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+
+    // create threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Fra_PortWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    // wait till all threads have quit (they stop soon after the verdict is known)
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+
+    // collect the result
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Fra_PortThData_t * p = pThData + i;
+        if ( p->fWinner )
+        {
+            RetValue = p->Status == l_True ? 0 : 1;
+            if ( p->Status == l_True )
+                pMan->pData = Sat_SolverGetModel( p->pSat, vCiIds->pArray, vCiIds->nSize );
+        }
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "Solver %2d : %s restarts. Conf = %9d. Exported = %7d. Imported = %7d. %-6s",
+                i, p->pSat->fGeomRestart ? "geom" : "luby", (int)p->pSat->stats.conflicts, p->nExported, p->nImported, p->fWinner ? "first" : "" );
+            Abc_PrintTime( 1, "Time", p->Time );
+        }
+        if ( pTele )
+            Sat_SolverTeleCollect( p->pSat, (Sat_Tele_t *)pTele );
+        sat_solver_delete( p->pSat );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pThData );
+    ABC_FREE( Ring.pSlots );
+    Vec_IntFree( vCiIds );
+    return RetValue;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
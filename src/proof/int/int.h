@@ -65,7 +65,10 @@ struct Inter_ManParams_t_
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
+    int  fSilent;       // totally silent execution
     int  iFrameMax;     // the time frame reached
+    int  RunId;         // interpolation id in this run
+    int(*pFuncStop)(int); // callback to terminate
     char * pFileName;   // file name to dump interpolant
 };
 
@@ -62,6 +62,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
     p->fVerbose      = 0;     // print verbose statistics
+    p->fSilent       = 0;     // totally silent execution
     p->iFrameMax     =-1;
 }
 
@@ -97,14 +98,15 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
     if ( pPars->fVerbose && Saig_ManConstrNum(pAig) )
         printf( "Performing interpolation with %d constraints...\n", Saig_ManConstrNum(pAig) );
 
-    if ( Inter_ManCheckInitialState(pAig) )
+    if ( Inter_ManCheckInitialState(pAig, pPars->fVerbose) )
     {
         *piFrame = -1;
-        printf( "Property trivially fails in the initial state.\n" );
+        if ( !pPars->fSilent )
+            printf( "Property trivially fails in the initial state.\n" );
         return 0;
     }
 /*
-    if ( Inter_ManCheckAllStates(pAig) )
+    if ( Inter_ManCheckAllStates(pAig, pPars->fVerbose) )
     {
         printf( "Property trivially holds in all states.\n" );
         return 1;
@@ -196,6 +198,15 @@ p->timeEqu += Abc_Clock() - clk;
         // iterate the interpolation procedure
         for ( i = 0; ; i++ )
         {
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation is cancelled by the callback.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
@@ -242,10 +253,13 @@ p->timeEqu += Abc_Clock() - clk;
                         pParsBmc->nConfLimit = 100000000;
                         pParsBmc->nStart     = p->nFrames;
                         pParsBmc->fVerbose   = pPars->fVerbose;
+                        pParsBmc->fSilent    = pPars->fSilent;
+                        pParsBmc->RunId      = pPars->RunId;
+                        pParsBmc->pFuncStop  = pPars->pFuncStop;
                         RetValue = Saig_ManBmcScalable( pAig, pParsBmc );
-                        if ( RetValue == 1 )
+                        if ( RetValue == 1 && !pPars->fSilent )
                             printf( "Error: The problem should be SAT but it is UNSAT.\n" );
-                        else if ( RetValue == -1 )
+                        else if ( RetValue == -1 && !pPars->fSilent )
                             printf( "Error: The problem timed out.\n" );
                     }
                     Inter_ManStop( p, 0 );
@@ -264,6 +278,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation is cancelled by the callback.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -288,7 +307,8 @@ clk = Abc_Clock();
                 Aig_ManStop( pAigTemp );
                 if ( p->pInterNew == NULL )
                 {
-                    printf( "Reached timeout (%d seconds) during rewriting.\n",  pPars->nSecLimit );
+                    if ( !pPars->fSilent )
+                        printf( "Reached timeout (%d seconds) during rewriting.\n",  pPars->nSecLimit );
                     p->timeTotal = Abc_Clock() - clkTotal;
                     Inter_ManStop( p, 1 );
                     Inter_CheckStop( pCheck );
@@ -356,7 +376,8 @@ p->timeEqu += Abc_Clock() - clk - timeTemp;
             }
             if ( pPars->nSecLimit && Abc_Clock() > nTimeNewOut )
             {
-                printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
+                if ( !pPars->fSilent )
+                    printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 p->timeTotal = Abc_Clock() - clkTotal;
                 Inter_ManStop( p, 1 );
                 Inter_CheckStop( pCheck );
@@ -69,6 +69,8 @@ struct Inter_Man_t_
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
+    int              RunId;        // interpolation id in this run
+    int(*pFuncStop)(int);          // callback to terminate
     char *           pFileName;
     // runtime
     abctime          timeRwr;
@@ -126,8 +128,8 @@ extern int             Inter_ManPerformOneStepM114p( Inter_Man_t * p, int fUsePu
 #endif
 
 /*=== intUtil.c ============================================================*/
-extern int             Inter_ManCheckInitialState( Aig_Man_t * p );
-extern int             Inter_ManCheckAllStates( Aig_Man_t * p );
+extern int             Inter_ManCheckInitialState( Aig_Man_t * p, int fVerbose );
+extern int             Inter_ManCheckAllStates( Aig_Man_t * p, int fVerbose );
 
 
 
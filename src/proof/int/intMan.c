@@ -52,6 +52,8 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
+    p->RunId = pPars->RunId;
+    p->pFuncStop = pPars->pFuncStop;
     p->pFileName = pPars->pFileName;
     p->pAig = pAig;
     if ( pPars->fDropInvar )
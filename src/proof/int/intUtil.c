@@ -43,7 +43,7 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-int Inter_ManCheckInitialState( Aig_Man_t * p )
+int Inter_ManCheckInitialState( Aig_Man_t * p, int fVerbose )
 {
     Cnf_Dat_t * pCnf;
     Aig_Obj_t * pObj;
@@ -58,7 +58,8 @@ int Inter_ManCheckInitialState( Aig_Man_t * p )
         return 0;
     }
     status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
-    ABC_PRT( "Time", Abc_Clock() - clk );
+    if ( fVerbose )
+        ABC_PRT( "Time", Abc_Clock() - clk );
     if ( status == l_True )
     {
         p->pSeqModel = Abc_CexAlloc( Aig_ManRegNum(p), Saig_ManPiNum(p), 1 );
@@ -82,7 +83,7 @@ int Inter_ManCheckInitialState( Aig_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Inter_ManCheckAllStates( Aig_Man_t * p )
+int Inter_ManCheckAllStates( Aig_Man_t * p, int fVerbose )
 {
     Cnf_Dat_t * pCnf;
     sat_solver * pSat;
@@ -95,7 +96,8 @@ int Inter_ManCheckAllStates( Aig_Man_t * p )
         return 1;
     status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
     sat_solver_delete( pSat );
-    ABC_PRT( "Time", Abc_Clock() - clk );
+    if ( fVerbose )
+        ABC_PRT( "Time", Abc_Clock() - clk );
     return status == l_False;
 }
 
@@ -48,6 +48,9 @@ struct Pdr_Par_t_
     int nTimeOut;         // timeout in seconds
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
+    int nThreads;         // the number of threads solving clusters of outputs
+    int nLutSize;         // LUT size for LUT-based CNF (0 = use the default CNF)
+    void * pTele;         // SAT solver telemetry (Sat_Tele_t) collected if not NULL
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fDumpInv;         // dump inductive invariant
@@ -60,6 +63,7 @@ struct Pdr_Par_t_
     int fNotVerbose;      // not printing line by line progress
     int fSilent;          // totally silent execution
     int fSolveAll;        // do not stop when found a SAT output
+    int fSwarm;           // run differently configured threads sharing lemmas
     int fStoreCex;        // enable storing counter-examples in MO mode
     int fUseBridge;       // use bridge interface
     int nFailOuts;        // the number of failed outputs
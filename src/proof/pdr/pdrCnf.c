@@ -370,6 +370,9 @@ static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p,
     }
     pSat = (sat_solver *)Cnf_DataWriteIntoSolverInt( pSat, p->pCnf1, 1, fInit );
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
+    pSat->RunId = p->pPars->RunId;
+    pSat->pFuncStop = p->pPars->pFuncStop;
+    pSat->pStop = p->pfStop;
     return pSat;
 }
 
@@ -391,7 +394,10 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     assert( pSat );
     if ( p->pCnf2 == NULL )
     {
-        p->pCnf2     = Cnf_DeriveOtherWithMan( p->pCnfMan, p->pAig, 0 );
+        if ( p->pPars->nLutSize )
+            p->pCnf2 = Cnf_DeriveLut( p->pAig, p->pPars->nLutSize );
+        else
+            p->pCnf2 = Cnf_DeriveOtherWithMan( p->pCnfMan, p->pAig, 0 );
 #ifdef USE_PG
         p->pCnf2->pClaPols = Cnf_DataDeriveLitPolarities( p->pCnf2 );
 #endif
@@ -418,6 +424,9 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
 //    pSat = sat_solver_new();
     sat_solver_setnvars( pSat, 500 );
     sat_solver_set_runtime_limit( pSat, p->timeToStop );
+    pSat->RunId = p->pPars->RunId;
+    pSat->pFuncStop = p->pPars->pFuncStop;
+    pSat->pStop = p->pfStop;
     return pSat;
 }
 
@@ -54,6 +54,9 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nTimeOut       =       0;  // timeout in seconds
     pPars->nTimeOutGap    =       0;  // timeout in seconds since the last solved
     pPars->nConfLimit     =       0;  // limit on SAT solver conflicts
+    pPars->nThreads       =       0;  // the number of threads
+    pPars->nLutSize       =       0;  // LUT size for LUT-based CNF
+    pPars->fSwarm         =       0;  // run a swarm of threads sharing lemmas
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
@@ -518,6 +521,7 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             }
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
+            Pdr_LemPublish( p, pCubeMin );
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
@@ -546,6 +550,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pfStop && *p->pfStop )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -768,6 +774,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Abc_Print( 1, "*** Clauses after frame %d:\n", k );
             Pdr_ManPrintClauses( p, 0 );
         }
+        // add lemmas derived by other managers
+        Pdr_LemImport( p );
         // push clauses into this timeframe
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
@@ -814,7 +822,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pfStop && *p->pfStop) )
         {
             p->pPars->iFrame = k;
             return -1;
@@ -895,6 +903,10 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nThreads > 1 && pPars->fSwarm )
+        return Pdr_ManSolveSwarm( pAig, pPars );
+    if ( pPars->nThreads > 1 && Saig_ManPoNum(pAig) > 1 )
+        return Pdr_ManSolveMt( pAig, pPars );
     p = Pdr_ManStart( pAig, pPars, NULL );
     RetValue = Pdr_ManSolveInt( p );
     if ( RetValue == 0 )
@@ -62,6 +62,8 @@ struct Pdr_Obl_t_
     Pdr_Obl_t * pLink;     // queue link
 };
 
+typedef struct Pdr_Lem_t_ Pdr_Lem_t;  // lemmas shared by several managers
+
 typedef struct Pdr_Man_t_ Pdr_Man_t;
 struct Pdr_Man_t_
 {
@@ -82,6 +84,7 @@ struct Pdr_Man_t_
     Vec_Ptr_t * vCexes;    // counter-examples for each output
     Vec_Ptr_t * vSolvers;  // SAT solvers
     Vec_Vec_t * vClauses;  // clauses by timeframe
+    Vec_Ptr_t * vInvars;   // cubes of invariants imported from other runs
     Pdr_Obl_t * pQueue;    // proof obligations
     int *       pOrder;    // ordering of the lits
     Vec_Int_t * vActVars;  // the counter of activation variables
@@ -101,6 +104,13 @@ struct Pdr_Man_t_
     Vec_Int_t * vSuppLits; // support literals
     Pdr_Set_t * pCubeJust; // justification
     abctime *   pTime4Outs;// timeout per output
+    // lemma sharing
+    volatile int * pfStop; // the run stops when this flag is set by another manager
+    Pdr_Lem_t * pLems;     // lemmas shared with other managers
+    int         iLemOwner; // the number of this manager
+    int         iLemRead;  // the number of shared lemmas already seen
+    int         nLemsPub;  // the number of lemmas published
+    int         nLemsImp;  // the number of lemmas imported
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -162,8 +172,11 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
+extern int             Pdr_ManFindInvariantStart( Pdr_Man_t * p );
+extern Vec_Ptr_t *     Pdr_ManCollectCubes( Pdr_Man_t * p, int kStart );
 extern void            Pdr_ManPrintClauses( Pdr_Man_t * p, int kStart );
 extern void            Pdr_ManDumpClauses( Pdr_Man_t * p, char * pFileName, int fProved );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
@@ -172,6 +185,11 @@ extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
+/*=== pdrPth.c ==========================================================*/
+extern int             Pdr_ManSolveMt( Aig_Man_t * pAig, Pdr_Par_t * pPars );
+extern int             Pdr_ManSolveSwarm( Aig_Man_t * pAig, Pdr_Par_t * pPars );
+extern void            Pdr_LemPublish( Pdr_Man_t * p, Pdr_Set_t * pCube );
+extern int             Pdr_LemImport( Pdr_Man_t * p );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -126,11 +126,21 @@ void Pdr_ManStop( Pdr_Man_t * p )
     }
 //    Abc_Print( 1, "SS =%6d. SU =%6d. US =%6d. UU =%6d.\n", p->nCasesSS, p->nCasesSU, p->nCasesUS, p->nCasesUU );
     Vec_PtrForEachEntry( sat_solver *, p->vSolvers, pSat, i )
+    {
+        if ( p->pPars->pTele )
+            Sat_SolverTeleCollect( pSat, (Sat_Tele_t *)p->pPars->pTele );
         sat_solver_delete( pSat );
+    }
     Vec_PtrFree( p->vSolvers );
     Vec_VecForEachEntry( Pdr_Set_t *, p->vClauses, pCla, i, k )
         Pdr_SetDeref( pCla );
     Vec_VecFree( p->vClauses );
+    if ( p->vInvars )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vInvars, pCla, i )
+            Pdr_SetDeref( pCla );
+        Vec_PtrFree( p->vInvars );
+    }
     Pdr_QueueStop( p );
     ABC_FREE( p->pOrder );
     Vec_IntFree( p->vActVars );
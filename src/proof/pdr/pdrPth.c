@@ -0,0 +1,987 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Pdr_ManSolveMt( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    if ( !pPars->fSilent )
+        Abc_Print( 0, "Solving outputs in parallel requires ABC to be compiled with pthreads.\n" );
+    pPars->nThreads = 0;
+    return Pdr_ManSolve( pAig, pPars );
+}
+int Pdr_ManSolveSwarm( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    return Pdr_ManSolveMt( pAig, pPars );
+}
+void Pdr_LemPublish( Pdr_Man_t * p, Pdr_Set_t * pCube ) {}
+int  Pdr_LemImport( Pdr_Man_t * p )                     { return 0; }
+
+#else // pthreads are used
+
+// the shared lemmas are stored in chunks, which are never moved or freed
+// while the threads are running; as a result, the readers only need
+// to know the number of published lemmas to access them
+#define PDR_LEM_CHUNK_LOG   12
+#define PDR_LEM_CHUNK_MASK  ((1 << PDR_LEM_CHUNK_LOG) - 1)
+#define PDR_LEM_CHUNK_NUM   4096
+
+// append-only store of lemmas
+struct Pdr_Lem_t_
+{
+    Pdr_Set_t **     pCubes[PDR_LEM_CHUNK_NUM];  // chunks of lemmas
+    int *            pOwners[PDR_LEM_CHUNK_NUM]; // the managers publishing them
+    volatile int     nLems;      // the number of published lemmas
+    pthread_mutex_t  Mutex;      // serializes publishing
+};
+
+// cluster of outputs solved by one PDR run
+typedef struct Pdr_MtClu_t_ Pdr_MtClu_t;
+struct Pdr_MtClu_t_
+{
+    Aig_Man_t *      pAig;       // the cones of the outputs
+    Vec_Int_t *      vPos;       // original outputs of this cluster
+    Vec_Int_t *      vPiMap;     // maps local PIs into original PIs
+    Vec_Int_t *      vRegMap;    // maps local flops into original flops
+};
+
+// data shared by the threads
+typedef struct Pdr_MtMan_t_ Pdr_MtMan_t;
+struct Pdr_MtMan_t_
+{
+    Aig_Man_t *      pAig;       // the original design
+    Pdr_Par_t *      pPars;      // the original parameters
+    Vec_Ptr_t *      vClus;      // clusters of outputs
+    Vec_Ptr_t *      vCexes;     // counter-examples for each output
+    Vec_Ptr_t *      vInvars;    // proved invariant cubes over the original flops
+    Vec_Int_t *      vStatus;    // status of each output (0 = sat; 1 = unsat; negative = undecided)
+    int              iNext;      // the next cluster to be solved
+    int              iFrame;     // the largest frame explored
+    int              nImported;  // the number of cubes imported
+    volatile int     fStop;      // set to 1 when the threads should stop
+    time_t           Deadline;   // timeout (wall time)
+    int              nRunning;   // the number of running threads
+    pthread_mutex_t  Mutex;      // guards everything above
+    pthread_cond_t   Cond;       // signaled when a thread finishes
+    int              iWinner;    // the swarm thread producing the result
+};
+
+// information given to the swarm thread
+typedef struct Pdr_SwThData_t_ Pdr_SwThData_t;
+struct Pdr_SwThData_t_
+{
+    Pdr_MtMan_t *    p;          // shared data
+    Pdr_Lem_t *      pLems;      // shared lemmas
+    Aig_Man_t *      pAig;       // private copy of the design
+    Pdr_Par_t        Pars;       // the parameters of this thread
+    char             pName[8];   // the options toggled in this thread
+    Vec_Ptr_t *      vCexes;     // the counter-examples for each output
+    int              iThread;    // the number of this thread
+    int              RetValue;   // the result of this thread
+    int              nLemsPub;   // the number of lemmas published
+    int              nLemsImp;   // the number of lemmas imported
+    abctime          clkTotal;   // runtime of this thread
+};
+
+// information given to the thread
+typedef struct Pdr_MtThData_t_ Pdr_MtThData_t;
+struct Pdr_MtThData_t_
+{
+    Pdr_MtMan_t *    p;          // shared data
+    int              iThread;    // the number of this thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the threads to finish.]
+
+  Description [The PDR runs in the threads (and their SAT solvers) watch
+  the stop flag of the shared data. The flag is set by the threads when
+  the problem is decided, or by this procedure when the timeout is
+  reached or the callback of the user requests to stop. As a result,
+  the callback is only called by the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManMtWaitThreads( Pdr_MtMan_t * p )
+{
+    struct timespec Time;
+    int status;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    while ( p->nRunning > 0 )
+    {
+        if ( (p->Deadline && time(NULL) >= p->Deadline) || (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) )
+            p->fStop = 1;
+        Time.tv_sec  = time(NULL) + 1;
+        Time.tv_nsec = 0;
+        pthread_cond_timedwait( &p->Cond, &p->Mutex, &Time );
+    }
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+}
+static void Pdr_ManMtThreadDone( Pdr_MtMan_t * p )
+{
+    int status;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    p->nRunning--;
+    status = pthread_cond_signal( &p->Cond );  assert( status == 0 );
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects flops in the combinational support of the output.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManMtCollectSupp_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Int_t * vLo2Reg, Vec_Int_t * vSupp )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Pdr_ManMtCollectSupp_rec( p, Aig_ObjFanin0(pObj), vLo2Reg, vSupp );
+        Pdr_ManMtCollectSupp_rec( p, Aig_ObjFanin1(pObj), vLo2Reg, vSupp );
+    }
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_IntPush( vSupp, Vec_IntEntry(vLo2Reg, Aig_ObjId(pObj)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the outputs into clusters.]
+
+  Description [Outputs are added greedily to the cluster sharing most
+  flops with them, as long as at least half of the flops are shared.
+  The size of a cluster is limited to keep the threads busy.
+  Outputs without flops in their support are added to the last cluster.
+  Trivially solved outputs are not included. Returns NULL if none of
+  the outputs depends on the flops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Pdr_ManMtClusterOutputs( Aig_Man_t * p, int nThreads )
+{
+    Vec_Wec_t * vClus = Vec_WecAlloc( 100 );
+    Vec_Ptr_t * vSupps = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vComb = Vec_IntAlloc( 100 );
+    Vec_Int_t * vLo2Reg, * vSupp, * vSuppC, * vTemp;
+    Aig_Obj_t * pObj;
+    int i, c, nCommon, iBest, nBest;
+    int nLimit = Abc_MaxInt( 1, Saig_ManPoNum(p) / (4 * nThreads) );
+    vLo2Reg = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Saig_ManForEachLo( p, pObj, i )
+        Vec_IntWriteEntry( vLo2Reg, Aig_ObjId(pObj), i );
+    vSupp = Vec_IntAlloc( 100 );
+    Saig_ManForEachPo( p, pObj, i )
+    {
+        if ( Aig_ObjFanin0(pObj) == Aig_ManConst1(p) )
+            continue;
+        // collect the support
+        Vec_IntClear( vSupp );
+        Aig_ManIncrementTravId( p );
+        Pdr_ManMtCollectSupp_rec( p, Aig_ObjFanin0(pObj), vLo2Reg, vSupp );
+        if ( Vec_IntSize(vSupp) == 0 )
+        {
+            Vec_IntPush( vComb, i );
+            continue;
+        }
+        Vec_IntSort( vSupp, 0 );
+        // find the best cluster
+        iBest = -1; nBest = 0;
+        Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSuppC, c )
+        {
+            if ( Vec_IntSize(Vec_WecEntry(vClus, c)) >= nLimit )
+                continue;
+            nCommon = Vec_IntTwoCountCommon( vSupp, vSuppC );
+            if ( nCommon > nBest && 2 * nCommon >= Vec_IntSize(vSupp) )
+                iBest = c, nBest = nCommon;
+        }
+        if ( iBest == -1 )
+        {
+            iBest = Vec_WecSize(vClus);
+            Vec_WecPushLevel( vClus );
+            Vec_PtrPush( vSupps, Vec_IntDup(vSupp) );
+        }
+        else
+        {
+            vSuppC = (Vec_Int_t *)Vec_PtrEntry( vSupps, iBest );
+            Vec_PtrWriteEntry( vSupps, iBest, Vec_IntTwoMerge(vTemp = vSuppC, vSupp) );
+            Vec_IntFree( vTemp );
+        }
+        Vec_WecPush( vClus, iBest, i );
+    }
+    if ( Vec_WecSize(vClus) == 0 )
+        Vec_WecFreeP( &vClus );
+    else
+        Vec_IntAppend( Vec_WecEntryLast(vClus), vComb );
+    Vec_IntFree( vComb );
+    Vec_IntFree( vSupp );
+    Vec_IntFree( vLo2Reg );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    return vClus;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the cluster with the CI mapping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_MtClu_t * Pdr_ManMtCluStart( Aig_Man_t * p, Vec_Int_t * vPos )
+{
+    Pdr_MtClu_t * pClu;
+    Vec_Int_t * vId2Ci;
+    Aig_Obj_t * pObj;
+    int i;
+    pClu = ABC_CALLOC( Pdr_MtClu_t, 1 );
+    pClu->vPos = Vec_IntDup( vPos );
+    pClu->pAig = Saig_ManDupCones( p, Vec_IntArray(vPos), Vec_IntSize(vPos) );
+    // the CIs in the cone are marked and point to the new CIs
+    vId2Ci = Vec_IntStartFull( Aig_ManObjNumMax(pClu->pAig) );
+    Aig_ManForEachCi( p, pObj, i )
+        if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+            Vec_IntWriteEntry( vId2Ci, Aig_ObjId((Aig_Obj_t *)pObj->pData), i );
+    pClu->vPiMap  = Vec_IntAlloc( Saig_ManPiNum(pClu->pAig) );
+    Saig_ManForEachPi( pClu->pAig, pObj, i )
+        Vec_IntPush( pClu->vPiMap, Vec_IntEntry(vId2Ci, Aig_ObjId(pObj)) );
+    pClu->vRegMap = Vec_IntAlloc( Saig_ManRegNum(pClu->pAig) );
+    Saig_ManForEachLo( pClu->pAig, pObj, i )
+        Vec_IntPush( pClu->vRegMap, Vec_IntEntry(vId2Ci, Aig_ObjId(pObj)) - Saig_ManPiNum(p) );
+    Vec_IntFree( vId2Ci );
+    return pClu;
+}
+void Pdr_ManMtCluStop( Pdr_MtClu_t * pClu )
+{
+    Aig_ManStop( pClu->pAig );
+    Vec_IntFree( pClu->vPos );
+    Vec_IntFree( pClu->vPiMap );
+    Vec_IntFree( pClu->vRegMap );
+    ABC_FREE( pClu );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the counter-example of the cluster into the design.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Pdr_ManMtRemapCex( Aig_Man_t * p, Pdr_MtClu_t * pClu, Abc_Cex_t * pCexClu )
+{
+    Abc_Cex_t * pCex;
+    int f, i;
+    pCex = Abc_CexAlloc( Saig_ManRegNum(p), Saig_ManPiNum(p), pCexClu->iFrame + 1 );
+    pCex->iPo    = Vec_IntEntry( pClu->vPos, pCexClu->iPo );
+    pCex->iFrame = pCexClu->iFrame;
+    for ( f = 0; f <= pCexClu->iFrame; f++ )
+        for ( i = 0; i < pCexClu->nPis; i++ )
+            if ( Abc_InfoHasBit(pCexClu->pData, pCexClu->nRegs + f * pCexClu->nPis + i) )
+                Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + Vec_IntEntry(pClu->vPiMap, i) );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges invariant cubes with the shared store.]
+
+  Description [Import returns the cubes whose flops belong to the cluster.
+  Export adds the cubes of the inductive invariant of the cluster.
+  Both procedures are called with the mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Pdr_ManMtImportInvars( Pdr_MtMan_t * p, Pdr_MtClu_t * pClu )
+{
+    Vec_Ptr_t * vInvars;
+    Vec_Int_t * vReg2Loc, * vCube, * vLits, * vPiLits;
+    int i, k, Lit, iReg;
+    if ( Vec_PtrSize(p->vInvars) == 0 )
+        return NULL;
+    vReg2Loc = Vec_IntStartFull( Saig_ManRegNum(p->pAig) );
+    Vec_IntForEachEntry( pClu->vRegMap, iReg, i )
+        Vec_IntWriteEntry( vReg2Loc, iReg, i );
+    vInvars = Vec_PtrAlloc( 100 );
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vInvars, vCube, i )
+    {
+        Vec_IntClear( vLits );
+        Vec_IntForEachEntry( vCube, Lit, k )
+        {
+            iReg = Vec_IntEntry( vReg2Loc, Abc_Lit2Var(Lit) );
+            if ( iReg == -1 )
+                break;
+            Vec_IntPush( vLits, Abc_Var2Lit(iReg, Abc_LitIsCompl(Lit)) );
+        }
+        if ( k == Vec_IntSize(vCube) )
+            Vec_PtrPush( vInvars, Pdr_SetCreate(vLits, vPiLits) );
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vReg2Loc );
+    if ( Vec_PtrSize(vInvars) == 0 )
+        Vec_PtrFreeP( &vInvars );
+    return vInvars;
+}
+void Pdr_ManMtExportInvars( Pdr_MtMan_t * p, Pdr_MtClu_t * pClu, Pdr_Man_t * pPdr )
+{
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vCube;
+    Pdr_Set_t * pCube;
+    int i, k;
+    vCubes = Pdr_ManCollectCubes( pPdr, Pdr_ManFindInvariantStart(pPdr) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        vCube = Vec_IntAlloc( pCube->nLits );
+        for ( k = 0; k < pCube->nLits; k++ )
+            if ( pCube->Lits[k] != -1 )
+                Vec_IntPush( vCube, Abc_Var2Lit(Vec_IntEntry(pClu->vRegMap, Abc_Lit2Var(pCube->Lits[k])), Abc_LitIsCompl(pCube->Lits[k])) );
+        Vec_PtrPush( p->vInvars, vCube );
+    }
+    Vec_PtrFree( vCubes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one cluster.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManMtSolveCluster( Pdr_MtMan_t * p, int iClu, int iThread )
+{
+    Pdr_MtClu_t * pClu = (Pdr_MtClu_t *)Vec_PtrEntry( p->vClus, iClu );
+    Pdr_Par_t Pars, * pPars = &Pars;
+    Pdr_Man_t * pPdr;
+    Abc_Cex_t * pCex;
+    int i, iPo, Status, RetValue, status;
+    int nProved = 0, nFailed = 0, nImported = 0;
+    abctime clk = Abc_Clock();
+    // the parameters of this run
+    *pPars = *p->pPars;
+    pPars->pTele        = NULL;
+    pPars->nThreads     = 0;
+    pPars->nTimeOut     = 0;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+    pPars->fStoreCex    = 1;
+    pPars->nFailOuts    = 0;
+    pPars->nDropOuts    = 0;
+    pPars->nProveOuts   = 0;
+    pPars->iFrame       = -1;
+    pPars->pFuncStop    = NULL;
+    pPars->pFuncOnFail  = NULL;
+    pPars->vOutMap      = NULL;
+    // solve the cluster
+    pPdr = Pdr_ManStart( pClu->pAig, pPars, NULL );
+    pPdr->pfStop = &p->fStop;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    pPdr->vInvars = Pdr_ManMtImportInvars( p, pClu );
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    nImported = pPdr->vInvars ? Vec_PtrSize(pPdr->vInvars) : 0;
+    RetValue = Pdr_ManSolveInt( pPdr );
+    // record the results
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    p->iFrame = Abc_MaxInt( p->iFrame, pPars->iFrame - 1 );
+    p->nImported += nImported;
+    if ( pPars->fSolveAll )
+    {
+        Vec_IntForEachEntry( pClu->vPos, iPo, i )
+        {
+            Status = Vec_IntEntry( pPars->vOutMap, i );
+            Vec_IntWriteEntry( p->vStatus, iPo, Status == -2 ? -1 : Status );
+            if ( Status == 1 )
+                nProved++;
+            if ( Status != 0 )
+                continue;
+            nFailed++;
+            pCex = Pdr_ManMtRemapCex( p->pAig, pClu, (Abc_Cex_t *)Vec_PtrEntry(pPdr->vCexes, i) );
+            if ( !p->pPars->fNotVerbose )
+                Abc_Print( 1, "Output %d was asserted in frame %d (cluster %d).\n", iPo, pCex->iFrame, iClu );
+            if ( p->pPars->pFuncOnFail && p->pPars->pFuncOnFail(iPo, p->pPars->fStoreCex ? pCex : NULL) )
+                p->fStop = 1;
+            if ( p->pPars->fStoreCex )
+                Vec_PtrWriteEntry( p->vCexes, iPo, pCex );
+            else
+            {
+                Vec_PtrWriteEntry( p->vCexes, iPo, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+                ABC_FREE( pCex );
+            }
+        }
+        Vec_IntFree( pPars->vOutMap );
+    }
+    else if ( RetValue == 1 )
+    {
+        nProved = Vec_IntSize(pClu->vPos);
+        Vec_IntForEachEntry( pClu->vPos, iPo, i )
+            Vec_IntWriteEntry( p->vStatus, iPo, 1 );
+    }
+    else if ( RetValue == 0 )
+    {
+        // the output is failed even if another thread has stopped the run
+        nFailed = 1;
+        p->fStop = 1;
+        pCex = Pdr_ManMtRemapCex( p->pAig, pClu, pClu->pAig->pSeqModel );
+        Vec_IntWriteEntry( p->vStatus, pCex->iPo, 0 );
+        if ( p->pAig->pSeqModel == NULL )
+            p->pAig->pSeqModel = pCex;
+        else
+            ABC_FREE( pCex );
+    }
+    // share the invariant if a fixed-point was reached
+    if ( RetValue == 1 || pPars->nProveOuts > 0 )
+        Pdr_ManMtExportInvars( p, pClu, pPdr );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Thread %2d : Cluster %4d : PO =%5d  FF =%6d  AND =%7d  Imported =%6d  Proved =%5d  Failed =%5d  Frame =%4d  ",
+            iThread, iClu, Vec_IntSize(pClu->vPos), Aig_ManRegNum(pClu->pAig), Aig_ManNodeNum(pClu->pAig),
+            nImported, nProved, nFailed, pPars->iFrame ), Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    Pdr_ManStop( pPdr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Keeps taking the next unsolved cluster until there are none.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManMtWorkerThread( void * pArg )
+{
+    Pdr_MtThData_t * pThData = (Pdr_MtThData_t *)pArg;
+    Pdr_MtMan_t * p = pThData->p;
+    int iClu, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+        iClu = (p->fStop || p->iNext == Vec_PtrSize(p->vClus)) ? -1 : p->iNext++;
+        status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+        if ( iClu == -1 )
+            break;
+        Pdr_ManMtSolveCluster( p, iClu, pThData->iThread );
+    }
+    Pdr_ManMtThreadDone( p );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves clusters of outputs using a pool of threads.]
+
+  Description [The outputs are grouped into clusters sharing flops.
+  The threads take clusters one at a time and solve them using PDR.
+  The status of the outputs is updated in a shared vector. The cubes
+  of the inductive invariants of the solved clusters are given to the
+  clusters solved later, if their flops belong to the cluster.
+  The results are returned in the same way as by Pdr_ManSolve().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveMt( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_MtMan_t * p;
+    Pdr_MtClu_t * pClu;
+    Pdr_MtThData_t * pThData;
+    pthread_t * pThreads;
+    Vec_Wec_t * vClus;
+    Vec_Int_t * vPos;
+    Aig_Obj_t * pObj;
+    int i, nThreads, status, RetValue;
+    // derive the clusters
+    vClus = Pdr_ManMtClusterOutputs( pAig, pPars->nThreads );
+    if ( vClus == NULL )
+    {
+        pPars->nThreads = 0;
+        return Pdr_ManSolve( pAig, pPars );
+    }
+    // prepare the shared data
+    p = ABC_CALLOC( Pdr_MtMan_t, 1 );
+    p->pAig     = pAig;
+    p->pPars    = pPars;
+    p->vCexes   = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    p->vInvars  = Vec_PtrAlloc( 1000 );
+    p->vStatus  = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+    p->iFrame   = -1;
+    p->Deadline = pPars->nTimeOut ? time(NULL) + pPars->nTimeOut : 0;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );  assert( status == 0 );
+    pPars->nFailOuts = pPars->nDropOuts = pPars->nProveOuts = 0;
+    // trivially solved outputs
+    Saig_ManForEachPo( pAig, pObj, i )
+        if ( Aig_ObjChild0(pObj) == Aig_ManConst0(pAig) )
+            Vec_IntWriteEntry( p->vStatus, i, 1 );
+        else if ( Aig_ObjChild0(pObj) == Aig_ManConst1(pAig) )
+        {
+            Vec_IntWriteEntry( p->vStatus, i, 0 );
+            if ( pPars->fSolveAll )
+                Vec_PtrWriteEntry( p->vCexes, i, pPars->fStoreCex ? Abc_CexMakeTriv(Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), i) : (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            else if ( pAig->pSeqModel == NULL )
+                pAig->pSeqModel = Abc_CexMakeTriv( Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), i );
+            p->fStop |= !pPars->fSolveAll;
+        }
+    // derive the cones of the clusters
+    p->vClus = Vec_PtrAlloc( Vec_WecSize(vClus) );
+    Vec_WecForEachLevel( vClus, vPos, i )
+        Vec_PtrPush( p->vClus, Pdr_ManMtCluStart(pAig, vPos) );
+    Vec_WecFree( vClus );
+    nThreads = Abc_MinInt( pPars->nThreads, Vec_PtrSize(p->vClus) );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Solving %d outputs grouped into %d clusters using %d threads.\n", Saig_ManPoNum(pAig), Vec_PtrSize(p->vClus), nThreads );
+    // start the threads
+    pThData  = ABC_CALLOC( Pdr_MtThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    p->nRunning = nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].p = p;
+        pThData[i].iThread = i;
+        status = pthread_create( pThreads + i, NULL, Pdr_ManMtWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    Pdr_ManMtWaitThreads( p );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pThData );
+    // collect the results
+    for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+    {
+        pPars->nProveOuts += (Vec_IntEntry(p->vStatus, i) == 1);
+        pPars->nFailOuts  += (Vec_IntEntry(p->vStatus, i) == 0);
+    }
+    pPars->nDropOuts = Saig_ManPoNum(pAig) - pPars->nProveOuts - pPars->nFailOuts;
+    pPars->iFrame = p->iFrame;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Proved = %d. Disproved = %d. Undecided = %d. Shared invariant cubes = %d. Imported = %d.\n",
+            pPars->nProveOuts, pPars->nFailOuts, pPars->nDropOuts, Vec_PtrSize(p->vInvars), p->nImported );
+    if ( pPars->nProveOuts == Saig_ManPoNum(pAig) )
+        RetValue = 1;
+    else if ( pPars->nFailOuts > 0 )
+        RetValue = 0;
+    else
+        RetValue = -1;
+    if ( pPars->fSolveAll )
+    {
+        Vec_IntFreeP( &pPars->vOutMap );
+        pPars->vOutMap = p->vStatus;
+        p->vStatus = NULL;
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = p->vCexes;
+        p->vCexes = NULL;
+    }
+    // cleanup
+    Vec_PtrForEachEntry( Pdr_MtClu_t *, p->vClus, pClu, i )
+        Pdr_ManMtCluStop( pClu );
+    Vec_PtrFree( p->vClus );
+    Vec_VecFree( (Vec_Vec_t *)p->vInvars );
+    Vec_IntFreeP( &p->vStatus );
+    Vec_PtrFreeFree( p->vCexes );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the store of shared lemmas.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Lem_t * Pdr_LemStart()
+{
+    Pdr_Lem_t * p;
+    int status;
+    p = ABC_CALLOC( Pdr_Lem_t, 1 );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    return p;
+}
+void Pdr_LemStop( Pdr_Lem_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nLems; i++ )
+        Pdr_SetDeref( p->pCubes[i >> PDR_LEM_CHUNK_LOG][i & PDR_LEM_CHUNK_MASK] );
+    for ( i = 0; i < PDR_LEM_CHUNK_NUM && p->pCubes[i]; i++ )
+    {
+        ABC_FREE( p->pCubes[i] );
+        ABC_FREE( p->pOwners[i] );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma derived by this manager.]
+
+  Description [The lemma is a cube blocked in some timeframe. It does not
+  intersect with the states reachable in one transition from the initial
+  state, independently of the generalization used to derive it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_LemPublish( Pdr_Man_t * pPdr, Pdr_Set_t * pCube )
+{
+    Pdr_Lem_t * p = pPdr->pLems;
+    Pdr_Set_t * pDup;
+    int iChunk, status;
+    if ( p == NULL )
+        return;
+    pDup = Pdr_SetDup( pCube );
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    iChunk = p->nLems >> PDR_LEM_CHUNK_LOG;
+    if ( iChunk < PDR_LEM_CHUNK_NUM )
+    {
+        if ( p->pCubes[iChunk] == NULL )
+        {
+            p->pCubes[iChunk]  = ABC_ALLOC( Pdr_Set_t *, PDR_LEM_CHUNK_MASK + 1 );
+            p->pOwners[iChunk] = ABC_ALLOC( int, PDR_LEM_CHUNK_MASK + 1 );
+        }
+        p->pCubes[iChunk][p->nLems & PDR_LEM_CHUNK_MASK]  = pDup;
+        p->pOwners[iChunk][p->nLems & PDR_LEM_CHUNK_MASK] = pPdr->iLemOwner;
+        p->nLems++;
+        pPdr->nLemsPub++;
+        pDup = NULL;
+    }
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    if ( pDup )
+        Pdr_SetDeref( pDup );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the lemmas published by other managers.]
+
+  Description [The lemmas are added to the first timeframe, which is sound
+  because they hold in the states reachable in one transition. Pushing
+  clauses moves them to the later timeframes when they are inductive
+  relative to the clauses of this manager. Returns the number of lemmas
+  imported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_LemImport( Pdr_Man_t * pPdr )
+{
+    Pdr_Lem_t * p = pPdr->pLems;
+    Pdr_Set_t * pCube;
+    int i, nLems, status, Counter = 0;
+    if ( p == NULL || Vec_PtrSize(pPdr->vSolvers) < 2 )
+        return 0;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    nLems = p->nLems;
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    for ( i = pPdr->iLemRead; i < nLems; i++ )
+    {
+        if ( p->pOwners[i >> PDR_LEM_CHUNK_LOG][i & PDR_LEM_CHUNK_MASK] == pPdr->iLemOwner )
+            continue;
+        pCube = p->pCubes[i >> PDR_LEM_CHUNK_LOG][i & PDR_LEM_CHUNK_MASK];
+        if ( Pdr_ManCheckContainment( pPdr, 1, pCube ) )
+            continue;
+        pCube = Pdr_SetDup( pCube );
+        Vec_VecPush( pPdr->vClauses, 1, pCube );
+        Pdr_ManSolverAddClause( pPdr, 1, pCube );
+        Counter++;
+    }
+    pPdr->iLemRead = nLems;
+    pPdr->nLemsImp += Counter;
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of one thread of the swarm.]
+
+  Description [Thread 0 uses the parameters given by the user. Other
+  threads toggle generalization and CNF settings according to the bits
+  of their number.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSwarmSetParams( Pdr_Par_t * pPars, Pdr_Par_t * pParsUser, int iThread, char * pName )
+{
+    *pPars = *pParsUser;
+    pPars->fTwoRounds   ^= (iThread >> 0) & 1;
+    pPars->fSkipGeneral ^= (iThread >> 1) & 1;
+    pPars->fShortest    ^= (iThread >> 2) & 1;
+    pPars->fMonoCnf     ^= (iThread >> 3) & 1;
+    pPars->fShiftStart  ^= (iThread >> 4) & 1;
+    pPars->nRecycle     *= 1 + (iThread >> 5);
+    sprintf( pName, "%s%s%s%s%s", pPars->fTwoRounds ? "r" : "-", pPars->fSkipGeneral ? "g" : "-",
+        pPars->fShortest ? "s" : "-", pPars->fMonoCnf ? "m" : "-", pPars->fShiftStart ? "i" : "-" );
+    pPars->pTele        = NULL;
+    pPars->nThreads     = 0;
+    pPars->nTimeOut     = 0;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+    pPars->nFailOuts    = 0;
+    pPars->nDropOuts    = 0;
+    pPars->nProveOuts   = 0;
+    pPars->iFrame       = -1;
+    pPars->pFuncStop    = NULL;
+    pPars->pFuncOnFail  = NULL;
+    pPars->vOutMap      = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Swarm thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManSwarmThread( void * pArg )
+{
+    Pdr_SwThData_t * pThData = (Pdr_SwThData_t *)pArg;
+    Pdr_MtMan_t * p = pThData->p;
+    Pdr_Man_t * pPdr;
+    abctime clk = Abc_Clock();
+    int k, status;
+    pPdr = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    pPdr->pfStop    = &p->fStop;
+    pPdr->pLems     = pThData->pLems;
+    pPdr->iLemOwner = pThData->iThread;
+    pThData->RetValue = Pdr_ManSolveInt( pPdr );
+    // the first decided thread stops the others
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    if ( pThData->RetValue != -1 && p->iWinner == -1 )
+    {
+        p->iWinner = pThData->iThread;
+        p->fStop = 1;
+    }
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    // save the results
+    pThData->vCexes = pPdr->vCexes;
+    pPdr->vCexes = NULL;
+    pThData->Pars.iFrame--;
+    if ( pThData->Pars.vOutMap )
+        for ( k = 0; k < Saig_ManPoNum(pThData->pAig); k++ )
+            if ( Vec_IntEntry(pThData->Pars.vOutMap, k) == -2 ) // unknown
+                Vec_IntWriteEntry( pThData->Pars.vOutMap, k, -1 ); // undec
+    pThData->nLemsPub = pPdr->nLemsPub;
+    pThData->nLemsImp = pPdr->nLemsImp;
+    Pdr_ManStop( pPdr );
+    pThData->clkTotal = Abc_Clock() - clk;
+    Pdr_ManMtThreadDone( p );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using a swarm of threads.]
+
+  Description [Each thread runs PDR with different settings on its own
+  copy of the design. The threads publish the lemmas they derive into
+  the shared store and import the lemmas of the others when they open
+  a new timeframe. The result of the first thread to decide the problem
+  is returned; if none of them does, the result of the thread solving
+  the most outputs is returned. The results are returned in the same
+  way as by Pdr_ManSolve().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveSwarm( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_MtMan_t * p;
+    Pdr_Lem_t * pLems;
+    Pdr_SwThData_t * pThData, * pBest;
+    pthread_t * pThreads;
+    int i, nThreads = pPars->nThreads, status;
+    // prepare the shared data
+    p = ABC_CALLOC( Pdr_MtMan_t, 1 );
+    p->pAig     = pAig;
+    p->pPars    = pPars;
+    p->iWinner  = -1;
+    p->Deadline = pPars->nTimeOut ? time(NULL) + pPars->nTimeOut : 0;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );  assert( status == 0 );
+    pLems = Pdr_LemStart();
+    // start the threads
+    pThData  = ABC_CALLOC( Pdr_SwThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    p->nRunning = nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].p       = p;
+        pThData[i].pLems   = pLems;
+        pThData[i].pAig    = Aig_ManDupSimple( pAig );
+        pThData[i].iThread = i;
+        Pdr_ManSwarmSetParams( &pThData[i].Pars, pPars, i, pThData[i].pName );
+        status = pthread_create( pThreads + i, NULL, Pdr_ManSwarmThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    Pdr_ManMtWaitThreads( p );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    // select the result
+    pBest = p->iWinner >= 0 ? pThData + p->iWinner : pThData;
+    if ( p->iWinner == -1 )
+        for ( i = 1; i < nThreads; i++ )
+            if ( pBest->Pars.nFailOuts + pBest->Pars.nProveOuts < pThData[i].Pars.nFailOuts + pThData[i].Pars.nProveOuts )
+                pBest = pThData + i;
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Abc_Print( 1, "Thread %2d (%s) : %-9s  Frame =%4d  Published =%7d  Imported =%7d  ", i, pThData[i].pName,
+                pThData[i].RetValue == 1 ? "proved" : (pThData[i].RetValue == 0 ? "disproved" : "undecided"),
+                pThData[i].Pars.iFrame, pThData[i].nLemsPub, pThData[i].nLemsImp );
+            Abc_PrintTime( 1, "Time", pThData[i].clkTotal );
+        }
+        Abc_Print( 1, "The result is taken from thread %d. Lemmas shared = %d.\n", (int)(pBest - pThData), pLems->nLems );
+    }
+    // transfer the result
+    pPars->iFrame     = pBest->Pars.iFrame;
+    pPars->nFailOuts  = pBest->Pars.nFailOuts;
+    pPars->nDropOuts  = pBest->Pars.nDropOuts;
+    pPars->nProveOuts = pBest->Pars.nProveOuts;
+    if ( pPars->fSolveAll )
+    {
+        Vec_IntFreeP( &pPars->vOutMap );
+        pPars->vOutMap = pBest->Pars.vOutMap;
+        pBest->Pars.vOutMap = NULL;
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = pBest->vCexes;
+        pBest->vCexes = NULL;
+    }
+    pAig->pSeqModel = pBest->pAig->pSeqModel;
+    pBest->pAig->pSeqModel = NULL;
+    // cleanup
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Vec_IntFreeP( &pThData[i].Pars.vOutMap );
+        Vec_PtrFreeFree( pThData[i].vCexes );
+        Aig_ManStop( pThData[i].pAig );
+    }
+    i = pBest->RetValue;
+    ABC_FREE( pThreads );
+    ABC_FREE( pThData );
+    Pdr_LemStop( pLems );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+    return i;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -46,12 +46,14 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
 {
     sat_solver * pSat;
     Aig_Obj_t * pObj;
+    Pdr_Set_t * pCube;
     int i;
     assert( Vec_PtrSize(p->vSolvers) == k );
     assert( Vec_VecSize(p->vClauses) == k );
     assert( Vec_IntSize(p->vActVars) == k );
     // create new solver
     pSat = sat_solver_new();
+    pSat->fTelemetry = (p->pPars->pTele != NULL);
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
@@ -59,6 +61,10 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     // add property cone
     Saig_ManForEachPo( p->pAig, pObj, i )
         Pdr_ObjSatVar( p, k, 1, pObj );
+    // add the imported invariants (they hold in all reachable states)
+    if ( k > 0 && p->vInvars )
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vInvars, pCube, i )
+            Pdr_ManSolverAddClause( p, k, pCube );
     return pSat;
 }
 
@@ -86,6 +92,8 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     p->nStarts++;
 //    sat_solver_delete( pSat );
 //    pSat = sat_solver_new();
+    if ( p->pPars->pTele )
+        Sat_SolverTeleCollect( pSat, (Sat_Tele_t *)p->pPars->pTele );
     sat_solver_restart( pSat );
     // create new SAT solver
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
@@ -98,6 +106,9 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     Vec_VecForEachLevelStart( p->vClauses, vArrayK, i, k )
         Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, j )
             Pdr_ManSolverAddClause( p, k, pCube );
+    if ( k > 0 && p->vInvars )
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vInvars, pCube, i )
+            Pdr_ManSolverAddClause( p, k, pCube );
     return pSat;
 }
 
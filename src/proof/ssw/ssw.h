@@ -84,6 +84,8 @@ struct Ssw_Pars_t_
     // callback
     void *           pData;
     void *           pFunc;
+    int              RunId;         // scorr id in this run
+    int(*pFuncStop)(int);           // callback to terminate (the resulting AIG is not valid if it fires)
 };
 
 typedef struct Ssw_RarPars_t_ Ssw_RarPars_t;
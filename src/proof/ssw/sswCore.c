@@ -289,6 +289,12 @@ Aig_Man_t * Ssw_SignalCorrespondenceRefine( Ssw_Man_t * p )
     nSatProof = nSatCallsSat = nRecycles = nSatFailsReal = nUniques = 0;
     for ( nIter = 0; ; nIter++ )
     {
+        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        {
+            if ( p->pPars->fVerbose )
+                Abc_Print( 1, "Signal correspondence is cancelled by the callback after %d iterations.\n", nIter );
+            goto finalize;
+        }
         if ( p->pPars->nStepsMax == nIter )
         {
             Abc_Print( 1, "Stopped signal correspondence after %d refiment iterations.\n", nIter );
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "sswInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -101,13 +102,8 @@ unsigned Ssw_SmlObjHashWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 ***********************************************************************/
 int Ssw_SmlObjIsConstWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 {
-    unsigned * pSims;
-    int i;
-    pSims = Ssw_ObjSim(p, pObj->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        if ( pSims[i] )
-            return 0;
-    return 1;
+    unsigned * pSims = Ssw_ObjSim(p, pObj->Id);
+    return Abc_SimdIsZero( pSims + p->nWordsPref, 0, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -123,14 +119,9 @@ int Ssw_SmlObjIsConstWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 ***********************************************************************/
 int Ssw_SmlObjsAreEqualWord( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 {
-    unsigned * pSims0, * pSims1;
-    int i;
-    pSims0 = Ssw_ObjSim(p, pObj0->Id);
-    pSims1 = Ssw_ObjSim(p, pObj1->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        if ( pSims0[i] != pSims1[i] )
-            return 0;
-    return 1;
+    unsigned * pSims0 = Ssw_ObjSim(p, pObj0->Id);
+    unsigned * pSims1 = Ssw_ObjSim(p, pObj1->Id);
+    return Abc_SimdIsEqual( pSims0 + p->nWordsPref, pSims1 + p->nWordsPref, 0, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -293,13 +284,8 @@ int Ssw_SmlCountEqual( Ssw_Sml_t * p, Aig_Obj_t * pObjLi, Aig_Obj_t * pObjLo )
 ***********************************************************************/
 int Ssw_SmlNodeIsZero( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 {
-    unsigned * pSims;
-    int i;
-    pSims = Ssw_ObjSim(p, pObj->Id);
-    for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
-        if ( pSims[i] )
-            return 0;
-    return 1;
+    unsigned * pSims = Ssw_ObjSim(p, pObj->Id);
+    return Abc_SimdIsZero( pSims + p->nWordsPref, 0, p->nWordsTotal - p->nWordsPref );
 }
 
 /**Function*************************************************************
@@ -332,20 +318,9 @@ int Ssw_SmlNodeIsZeroFrame( Ssw_Sml_t * p, Aig_Obj_t * pObj, int f )
 ***********************************************************************/
 int Ssw_SmlNodeCountOnesReal( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 {
-    unsigned * pSims;
-    int i, Counter = 0;
-    pSims = Ssw_ObjSim(p, Aig_Regular(pObj)->Id);
-    if ( Aig_Regular(pObj)->fPhase ^ Aig_IsComplement(pObj) )
-    {
-        for ( i = 0; i < p->nWordsTotal; i++ )
-            Counter += Aig_WordCountOnes( ~pSims[i] );
-    }
-    else
-    {
-        for ( i = 0; i < p->nWordsTotal; i++ )
-            Counter += Aig_WordCountOnes( pSims[i] );
-    }
-    return Counter;
+    unsigned * pSims = Ssw_ObjSim(p, Aig_Regular(pObj)->Id);
+    int fCompl = Aig_Regular(pObj)->fPhase ^ Aig_IsComplement(pObj);
+    return Abc_SimdCountOnes( pSims, fCompl ? ~0 : 0, p->nWordsTotal );
 }
 
 /**Function*************************************************************
@@ -706,7 +681,7 @@ void Ssw_SmlAssignDist1Plus( Ssw_Sml_t * p, unsigned * pPat )
 void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pSims, * pSims0, * pSims1;
-    int fCompl, fCompl0, fCompl1, i;
+    int fCompl, fCompl0, fCompl1;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pObj) );
     assert( Aig_ObjIsNode(pObj) );
@@ -720,42 +695,7 @@ void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
     fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
     fCompl1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj));
     // simulate
-    if ( fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] | pSims1[i]);
-    }
-    else if ( fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | ~pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] & pSims1[i]);
-    }
-    else if ( !fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & ~pSims1[i]);
-    }
-    else // if ( !fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] & pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & pSims1[i]);
-    }
+    Abc_SimdAnd( pSims, pSims0, pSims1, fCompl0 ? ~0 : 0, fCompl1 ? ~0 : 0, fCompl ? ~0 : 0, p->nWordsFrame );
 }
 
 /**Function*************************************************************
@@ -63,6 +63,9 @@ struct Saig_ParBmc_t_
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
+    int         nThreads;       // the number of threads solving outputs in parallel
+    int         nLutSize;       // LUT size for LUT-based CNF (0 = use 4-input cuts)
+    void *      pTele;          // SAT solver telemetry (Sat_Tele_t) collected if not NULL
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     int         fSilent;        // completely silent
@@ -70,7 +73,12 @@ struct Saig_ParBmc_t_
     int         nFailOuts;      // the number of failed outputs
     int         nDropOuts;      // the number of dropped outputs
     abctime     timeLastSolved; // the time when the last output was solved
+    int         RunId;          // BMC id in this run 
+    int(*pFuncStop)(int);       // callback to terminate
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
+    volatile int * pfStop;      // terminates when this flag is set (if not NULL)
+    void *      pFuncData;      // the data passed to pFuncOnFailData()
+    int(*pFuncOnFailData)(void*,int,Abc_Cex_t*); // called for a failed output in MO mode with pFuncData
 };
 
  
@@ -82,6 +90,7 @@ struct Bmc_AndPar_t_
     int         nFramesAdd;     // the number of additional frames
     int         nConfLimit;     // maximum number of conflicts at a node
     int         nTimeOut;       // timeout in seconds
+    int         nSatVarMax;     // the number of SAT variables to recycle the solver (0 = no limit)
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
@@ -106,6 +115,20 @@ struct Bmc_MulPar_t_
     int         fVeryVerbose;
 };
 
+typedef struct Bmc_PortPar_t_ Bmc_PortPar_t;
+struct Bmc_PortPar_t_
+{
+    int         nThreads;       // the number of concurrent engines
+    int         nTimeOut;       // approximate timeout in seconds
+    int         fUsePdr;        // race property directed reachability
+    int         fUseBmc;        // race bounded model checking (bmc3)
+    int         fUseInt;        // race interpolation
+    int         fUseInd;        // race induction (signal correspondence)
+    int         fVerbose;       // verbose 
+    int         iEngine;        // the engine that produced the verdict
+    int         iFrame;         // explored up to this frame
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -121,6 +144,8 @@ extern int               Saig_BmcPerform( Aig_Man_t * pAig, int nStart, int nFra
 /*=== bmcBmc3.c ==========================================================*/
 extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+/*=== bmcBmc3Pth.c ==========================================================*/
+extern int               Saig_ManBmcScalableMt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
 /*=== bmcCexCut.c ==========================================================*/
@@ -128,6 +153,9 @@ extern Gia_Man_t *       Bmc_GiaTargetStates( Gia_Man_t * p, Abc_Cex_t * pCex, i
 extern Aig_Man_t *       Bmc_AigTargetStates( Aig_Man_t * p, Abc_Cex_t * pCex, int iFrBeg, int iFrEnd, int fCombOnly, int fGenAll, int fAllFrames, int fVerbose );
 /*=== bmcCexMin.c ==========================================================*/
 extern Abc_Cex_t *       Saig_ManCexMinPerform( Aig_Man_t * pAig, Abc_Cex_t * pCex );
+/*=== bmcPort.c ==========================================================*/
+extern void              Bmc_PortSetDefaultParams( Bmc_PortPar_t * p );
+extern int               Gia_ManPortfolioProve( Gia_Man_t * p, Bmc_PortPar_t * pPars );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
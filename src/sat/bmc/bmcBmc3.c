@@ -23,6 +23,9 @@
 #include "sat/bsat/satStore.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
+#include "misc/vec/vecMem.h"
+#include "bool/kit/kit.h"
+#include "misc/util/utilTruth.h"
 #include "bmc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -41,6 +44,11 @@ struct Gia_ManBmc_t_
     // intermediate data
     Vec_Int_t *       vMapping;    // mapping
     Vec_Int_t *       vMapRefs;    // mapping references
+    int               nLutSize;    // the max number of fanins in the mapping
+    Vec_Wrd_t *       vTruths;     // truth tables of the LUTs (LUT-based CNF)
+    Vec_Mem_t *       vTtMem;      // hashed truth tables of the reduced LUTs
+    Vec_Wec_t *       vTtIsops;    // ISOPs of each hashed truth table and its complement
+    Vec_Int_t *       vCover;      // temporary ISOP
 //    Vec_Vec_t *       vSects;      // sections
     Vec_Int_t *       vId2Num;     // number of each node 
     Vec_Ptr_t *       vTerInfo;    // ternary information
@@ -68,6 +76,9 @@ struct Gia_ManBmc_t_
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
 
+// the number of integers in the hash key of a node (fanin literals followed by the truth table)
+static inline int Saig_ManBmcKeySize( Gia_ManBmc_t * p ) { return p->vTruths ? p->nLutSize + 2 : 5; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -675,7 +686,7 @@ void Saig_ManBmcMappingTest( Aig_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap )
+Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap, int nLutSize )
 {
     Vec_Int_t * vRefs;
     Aig_Obj_t * pObj;
@@ -688,7 +699,7 @@ Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap )
         if ( Vec_IntEntry(vMap, i) == 0 )
             continue;
         pData = Vec_IntEntryP( vMap, Vec_IntEntry(vMap, i) );
-        for ( iFan = 0; iFan < 4; iFan++ )
+        for ( iFan = 0; iFan < nLutSize; iFan++ )
             if ( pData[iFan+1] >= 0 )
                 Vec_IntAddToEntry( vRefs, pData[iFan+1], 1 );
     }
@@ -706,7 +717,7 @@ Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne )
+Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nLutSize )
 {
     Gia_ManBmc_t * p;
     Aig_Obj_t * pObj;
@@ -715,8 +726,21 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne )
     p = ABC_CALLOC( Gia_ManBmc_t, 1 );
     p->pAig = pAig;
     // create mapping
-    p->vMapping = Cnf_DeriveMappingArray( pAig );
-    p->vMapRefs = Saig_ManBmcComputeMappingRefs( pAig, p->vMapping );
+    if ( nLutSize > 0 )
+    {
+        p->nLutSize = nLutSize;
+        p->vMapping = Cnf_DeriveLutMapping( pAig, nLutSize, &p->vTruths );
+        p->vTtMem   = Vec_MemAlloc( 1, 12 );
+        Vec_MemHashAlloc( p->vTtMem, 10000 );
+        p->vTtIsops = Vec_WecAlloc( 10000 );
+        p->vCover   = Vec_IntAlloc( 1 << 10 );
+    }
+    else
+    {
+        p->nLutSize = 4;
+        p->vMapping = Cnf_DeriveMappingArray( pAig );
+    }
+    p->vMapRefs = Saig_ManBmcComputeMappingRefs( pAig, p->vMapping, p->nLutSize );
     // create sections
 //    p->vSects = Saig_ManBmcSections( pAig );
     // map object IDs into their numbers and section numbers
@@ -741,8 +765,8 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne )
     // terminary simulation 
     p->nWordNum = Abc_BitWordNum( 2 * Aig_ManObjNumMax(pAig) );
     // hash table
-    p->vData = Vec_IntAlloc( 5 * 10000 );
-    p->vHash = Hsh_IntManStart( p->vData, 5, 10000 );
+    p->vData = Vec_IntAlloc( Saig_ManBmcKeySize(p) * 10000 );
+    p->vHash = Hsh_IntManStart( p->vData, Saig_ManBmcKeySize(p), 10000 );
     p->vId2Lit = Vec_IntAlloc( 10000 );
     // time spent on each outputs
     if ( nTimeOutOne )
@@ -787,10 +811,20 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_WecFree( p->vVisited );
     Vec_IntFree( p->vMapping );
     Vec_IntFree( p->vMapRefs );
+    Vec_WrdFreeP( &p->vTruths );
+    if ( p->vTtMem )
+    {
+        Vec_MemHashFree( p->vTtMem );
+        Vec_MemFree( p->vTtMem );
+    }
+    Vec_WecFreeP( &p->vTtIsops );
+    Vec_IntFreeP( &p->vCover );
 //    Vec_VecFree( p->vSects );
     Vec_IntFree( p->vId2Num );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
+    if ( p->pPars->pTele )
+        Sat_SolverTeleCollect( p->pSat, (Sat_Tele_t *)p->pPars->pTele );
     sat_solver_delete( p->pSat );
     ABC_FREE( p->pTime4Outs );
     Vec_IntFree( p->vData );
@@ -987,6 +1021,121 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for one LUT.]
+
+  Description [The ISOPs of the truth table and its complement are
+  computed once for each reduced function and reused in all timeframes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Saig_ManBmcAddClausesLut( Gia_ManBmc_t * p, word uTruth, int Lits[], int iLitOut )
+{
+    Vec_Int_t * vIsop;
+    int i, k, v, Cube, Literal, iTt, nClaLits, ClaLits[8];
+    iTt = Vec_MemHashInsert( p->vTtMem, &uTruth );
+    if ( iTt == Vec_WecSize(p->vTtIsops) / 2 )
+    {
+        for ( i = 0; i < 2; i++ )
+        {
+            word uTemp = i ? ~uTruth : uTruth;
+            int RetValue = Kit_TruthIsop( (unsigned *)&uTemp, p->nLutSize, p->vCover, 0 );
+            assert( RetValue == 0 );
+            Vec_IntAppend( Vec_WecPushLevel(p->vTtIsops), p->vCover );
+        }
+    }
+    // write positive/negative polarity
+    for ( i = 0; i < 2; i++ )
+    {
+        vIsop = Vec_WecEntry( p->vTtIsops, 2 * iTt + i );
+        Vec_IntForEachEntry( vIsop, Cube, k )
+        {
+            nClaLits = 0;
+            ClaLits[nClaLits++] = i ? lit_neg(iLitOut) : iLitOut;
+            for ( v = 0; v < p->nLutSize; v++ )
+            {
+                Literal = 3 & (Cube >> (v << 1));
+                if ( Literal == 1 ) // value 0 --> write positive literal
+                {
+                    assert( Lits[v] > 1 );
+                    ClaLits[nClaLits++] = Lits[v];
+                }
+                else if ( Literal == 2 ) // value 1 --> write negative literal
+                {
+                    assert( Lits[v] > 1 );
+                    ClaLits[nClaLits++] = lit_neg(Lits[v]);
+                }
+            }
+            if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
+                assert( 0 );
+        }
+    }
+}
+static inline int Saig_ManBmcCreateCnfLut( Gia_ManBmc_t * p, word uTruth, int Lits[] )
+{
+    int i, k, iLit, iEntry, iRes, fCompl, Temp;
+    // propagate constants
+    for ( i = 0; i < p->nLutSize; i++ )
+        if ( Lits[i] == 0 )
+        {
+            uTruth = Abc_Tt6Cofactor0( uTruth, i );
+            Lits[i] = -1;
+        }
+        else if ( Lits[i] == 1 )
+        {
+            uTruth = Abc_Tt6Cofactor1( uTruth, i );
+            Lits[i] = -1;
+        }
+    for ( i = 0; i < p->nLutSize; i++ )
+        if ( Lits[i] >= 0 && !Abc_Tt6HasVar(uTruth, i) )
+            Lits[i] = -1;
+    if ( uTruth == 0 || ~uTruth == 0 )
+        return (int)(uTruth != 0);
+    // canonicize inputs by sorting the literals (unused inputs go last)
+    for ( i = 0; i < p->nLutSize; i++ )
+        for ( k = 0; k < p->nLutSize - 1 - i; k++ )
+            if ( (unsigned)Lits[k] > (unsigned)Lits[k+1] )
+            {
+                Temp = Lits[k]; Lits[k] = Lits[k+1]; Lits[k+1] = Temp;
+                uTruth = Abc_Tt6SwapAdjacent( uTruth, k );
+            }
+    if ( uTruth == s_Truths6[0] || uTruth == ~s_Truths6[0] )
+    {
+        p->nBufNum++;
+        return Abc_LitNotCond( Lits[0], uTruth != s_Truths6[0] );
+    }
+    fCompl = (int)(uTruth & 1);
+    if ( fCompl )
+        uTruth = ~uTruth;
+    // hash the node
+    iEntry = Vec_IntSize(p->vData) / Saig_ManBmcKeySize(p);
+    assert( iEntry * Saig_ManBmcKeySize(p) == Vec_IntSize(p->vData) );
+    for ( i = 0; i < p->nLutSize; i++ )
+        Vec_IntPush( p->vData, Lits[i] );
+    Vec_IntPush( p->vData, (int)(uTruth & 0xFFFFFFFF) );
+    Vec_IntPush( p->vData, (int)(uTruth >> 32) );
+    iRes = Hsh_IntManAdd( p->vHash, iEntry );
+    if ( iRes == iEntry )
+    {
+        iLit = toLit( p->nSatVars++ );
+        Saig_ManBmcAddClausesLut( p, uTruth, Lits, iLit );
+        assert( iEntry == Vec_IntSize(p->vId2Lit) );
+        Vec_IntPush( p->vId2Lit, iLit );
+        p->nHashMiss++;
+    }
+    else
+    {
+        iLit = Vec_IntEntry( p->vId2Lit, iRes );
+        Vec_IntShrink( p->vData, Vec_IntSize(p->vData) - Saig_ManBmcKeySize(p) );
+        p->nHashHit++;
+    }
+    return Abc_LitNotCond( iLit, fCompl );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF for one node.]
@@ -1001,7 +1150,7 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
 int Saig_ManBmcCreateCnf_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     extern unsigned Dar_CutSortVars( unsigned uTruth, int * pVars );
-    int * pMapping, i, iLit, Lits[5], uTruth;
+    int * pMapping, i, iLit, Lits[8], uTruth;
     iLit = Saig_ManBmcLiteral( p, pObj, iFrame );
     if ( iLit != ~0 )
         return iLit; 
@@ -1023,11 +1172,16 @@ int Saig_ManBmcCreateCnf_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
     }
     assert( Aig_ObjIsNode(pObj) );
     pMapping = Saig_ManBmcMapping( p, pObj );
-    for ( i = 0; i < 4; i++ )
+    for ( i = 0; i < p->nLutSize; i++ )
         if ( pMapping[i+1] == -1 )
             Lits[i] = -1;
         else
             Lits[i] = Saig_ManBmcCreateCnf_rec( p, Aig_ManObj(p->pAig, pMapping[i+1]), iFrame );
+    if ( p->vTruths )
+    {
+        iLit = Saig_ManBmcCreateCnfLut( p, Vec_WrdEntry(p->vTruths, pMapping[0]), Lits );
+        return Saig_ManBmcSetLiteral( p, pObj, iFrame, iLit );
+    }
     uTruth = 0xffff & (unsigned)pMapping[0];
     // propagate constants
     uTruth = Saig_ManBmcReduceTruth( uTruth, Lits );
@@ -1108,7 +1262,7 @@ void Saig_ManBmcCreateCnf_iter( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame,
         int * pMapping, i;
         assert( Aig_ObjIsNode(pObj) );
         pMapping = Saig_ManBmcMapping( p, pObj );
-        for ( i = 0; i < 4; i++ )
+        for ( i = 0; i < p->nLutSize; i++ )
             if ( pMapping[i+1] != -1 )
                 Saig_ManBmcCreateCnf_iter( p, Aig_ManObj(p->pAig, pMapping[i+1]), iFrame, vVisit );
     }
@@ -1289,6 +1443,8 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->nThreads       =     0;    // the number of threads
+    p->nLutSize       =     0;    // LUT size for LUT-based CNF
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1371,6 +1527,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     abctime clk, clk2, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    if ( pPars->nThreads > 1 && Saig_ManPoNum(pAig) > 1 && !pPars->fUseBridge )
+        return Saig_ManBmcScalableMt( pAig, pPars );
     if ( pPars->nTimeOutOne )
         pPars->nTimeOut = pPars->nTimeOutOne * Saig_ManPoNum(pAig) / 1000 + 1;
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1378,12 +1536,16 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     nTimeToStopNG = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
     nTimeToStop   = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
     // create BMC manager
-    p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne );
+    p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nLutSize );
     p->pPars = pPars;
     p->pSat->nLearntStart = p->pPars->nLearnedStart;
     p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
     p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
     p->pSat->nLearntMax   = p->pSat->nLearntStart;
+    p->pSat->RunId        = p->pPars->RunId;
+    p->pSat->pFuncStop    = p->pPars->pFuncStop;
+    p->pSat->pStop        = p->pPars->pfStop;
+    p->pSat->fTelemetry   = (p->pPars->pTele != NULL);
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
     if ( pPars->fVerbose )
@@ -1403,6 +1565,13 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     pPars->timeLastSolved = Abc_Clock();
     for ( f = 0; f < pPars->nFramesMax; f++ )
     {
+        // stop BMC if requested by the caller
+        if ( (pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) || (pPars->pfStop && *pPars->pfStop) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Bmc3 is cancelled by the callback in frame %d.\n", f );
+            goto finish;
+        }
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
@@ -1482,7 +1651,8 @@ clkOther += Abc_Clock() - clk2;
                 if ( !pPars->fSolveAll )
                 {
                     Abc_Cex_t * pCex = Abc_CexMakeTriv( Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), f*Saig_ManPoNum(pAig)+i );
-                    Abc_Print( 1, "Output %d is trivially SAT in frame %d.\n", i, f );
+                    if ( !pPars->fSilent )
+                        Abc_Print( 1, "Output %d is trivially SAT in frame %d.\n", i, f );
                     ABC_FREE( pAig->pSeqModel );
                     pAig->pSeqModel = pCex;
                     goto finish;
@@ -1501,7 +1671,8 @@ clkOther += Abc_Clock() - clk2;
                     pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 }
                 Vec_PtrWriteEntry( p->vCexes, i, pCexNew );
-                if ( pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL) )
+                if ( (pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL)) ||
+                     (pPars->pFuncOnFailData && pPars->pFuncOnFailData(pPars->pFuncData, i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL)) )
                 {
                     Abc_Print( 1, "Quitting due to callback on fail.\n" );
                     goto finish;
@@ -1598,7 +1769,8 @@ nTimeSat += Abc_Clock() - clk2;
                     pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 }
                 Vec_PtrWriteEntry( p->vCexes, i, pCexNew );
-                if ( pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL) )
+                if ( (pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL)) ||
+                     (pPars->pFuncOnFailData && pPars->pFuncOnFailData(pPars->pFuncData, i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL)) )
                 {
                     Abc_Print( 1, "Quitting due to callback on fail.\n" );
                     goto finish;
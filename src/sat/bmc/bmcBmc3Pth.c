@@ -0,0 +1,513 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmc3Pth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Multi-threaded BMC with dynamic unrolling.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcBmc3Pth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "misc/vec/vecWec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Saig_ManBmcScalableMt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    if ( !pPars->fSilent )
+        Abc_Print( 0, "Solving outputs in parallel requires ABC to be compiled with pthreads.\n" );
+    pPars->nThreads = 0;
+    return Saig_ManBmcScalable( pAig, pPars );
+}
+
+#else // pthreads are used
+
+typedef struct Saig_BmcMtMan_t_ Saig_BmcMtMan_t;
+
+// part of the outputs unrolled and solved by one thread
+typedef struct Saig_BmcMtPart_t_ Saig_BmcMtPart_t;
+struct Saig_BmcMtPart_t_
+{
+    Saig_BmcMtMan_t * p;         // shared data
+    Aig_Man_t *      pAig;       // the cones of the outputs
+    Vec_Int_t *      vPos;       // original outputs of this part
+    Vec_Int_t *      vPiMap;     // maps local PIs into original PIs
+    Saig_ParBmc_t    Pars;       // the parameters of this thread
+    pthread_t        Thread;     // the thread solving this part
+    int              iPart;      // the index of this part
+    volatile int     fStop;      // set to 1 when this part should stop
+    int              RetValue;   // the result of this thread
+    abctime          clkTotal;   // runtime of this thread
+};
+
+// data shared by the threads
+struct Saig_BmcMtMan_t_
+{
+    Aig_Man_t *      pAig;       // the original design
+    Saig_ParBmc_t *  pPars;      // the original parameters
+    Vec_Ptr_t *      vParts;     // parts of the outputs
+    Vec_Ptr_t *      vCexes;     // counter-examples for each output
+    Abc_Cex_t *      pCex;       // the shallowest counter-example
+    volatile int     iFrameCex;  // the frame of the shallowest counter-example
+    volatile int     fStop;      // set to 1 when the threads should stop
+    int              nRunning;   // the number of running threads
+    time_t           Deadline;   // timeout (wall time)
+    pthread_mutex_t  Mutex;      // guards everything above
+    pthread_cond_t   Cond;       // signals that a thread is done or a cex is found
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the threads to finish.]
+
+  Description [The BMC runs in the threads (and their SAT solvers) watch
+  the stop flags of their parts. The flags are set by this procedure
+  when the timeout is reached, the callback of the user requests to stop,
+  or a part moves past the frame of the shallowest counter-example found
+  by any of the threads. As a result, the callback is only called by the
+  calling thread. The threads signal when a counter-example is found or
+  when they are done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_ManBmcMtWaitThreads( Saig_BmcMtMan_t * p )
+{
+    Saig_BmcMtPart_t * pPart;
+    struct timespec Time;
+    int i, status;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    while ( p->nRunning > 0 )
+    {
+        if ( (p->Deadline && time(NULL) >= p->Deadline) || (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) )
+            p->fStop = 1;
+        Vec_PtrForEachEntry( Saig_BmcMtPart_t *, p->vParts, pPart, i )
+            if ( p->fStop || pPart->Pars.iFrame >= p->iFrameCex )
+                pPart->fStop = 1;
+        Time.tv_sec  = time(NULL) + 1;
+        Time.tv_nsec = 0;
+        pthread_cond_timedwait( &p->Cond, &p->Mutex, &Time );
+    }
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects flops in the combinational support of the output.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcMtCollectSupp_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Int_t * vSupp )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Saig_ManBmcMtCollectSupp_rec( p, Aig_ObjFanin0(pObj), vSupp );
+        Saig_ManBmcMtCollectSupp_rec( p, Aig_ObjFanin1(pObj), vSupp );
+    }
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_IntPush( vSupp, Aig_ObjCioId(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the outputs into parts solved by the threads.]
+
+  Description [First, outputs are grouped greedily with the outputs
+  sharing at least half of their flops, so that the unrolling of the
+  shared logic is not duplicated. The size of a group is limited to keep
+  all threads busy. Next, the groups are distributed among the parts,
+  largest first, each to the part with the fewest outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Saig_ManBmcMtPartition( Aig_Man_t * p, int nParts )
+{
+    Vec_Wec_t * vGroups = Vec_WecAlloc( 100 );
+    Vec_Wec_t * vParts  = Vec_WecStart( nParts );
+    Vec_Ptr_t * vSupps  = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vSupp, * vSuppG, * vTemp, * vGroup;
+    Aig_Obj_t * pObj;
+    int i, g, nCommon, iBest, nBest, * pCosts, * pPerm;
+    int nLimit = Abc_MaxInt( 1, (Saig_ManPoNum(p) + nParts - 1) / nParts );
+    // group the outputs
+    vSupp = Vec_IntAlloc( 100 );
+    Saig_ManForEachPo( p, pObj, i )
+    {
+        Vec_IntClear( vSupp );
+        Aig_ManIncrementTravId( p );
+        Saig_ManBmcMtCollectSupp_rec( p, Aig_ObjFanin0(pObj), vSupp );
+        Vec_IntSort( vSupp, 0 );
+        iBest = -1; nBest = 0;
+        Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSuppG, g )
+        {
+            if ( Vec_IntSize(Vec_WecEntry(vGroups, g)) >= nLimit )
+                continue;
+            nCommon = Vec_IntTwoCountCommon( vSupp, vSuppG );
+            if ( nCommon > nBest && 2 * nCommon >= Vec_IntSize(vSupp) )
+                iBest = g, nBest = nCommon;
+        }
+        if ( iBest == -1 )
+        {
+            iBest = Vec_WecSize(vGroups);
+            Vec_WecPushLevel( vGroups );
+            Vec_PtrPush( vSupps, Vec_IntDup(vSupp) );
+        }
+        else
+        {
+            vSuppG = (Vec_Int_t *)Vec_PtrEntry( vSupps, iBest );
+            Vec_PtrWriteEntry( vSupps, iBest, Vec_IntTwoMerge(vTemp = vSuppG, vSupp) );
+            Vec_IntFree( vTemp );
+        }
+        Vec_WecPush( vGroups, iBest, i );
+    }
+    Vec_IntFree( vSupp );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    // distribute the groups, largest first
+    pCosts = ABC_ALLOC( int, Vec_WecSize(vGroups) );
+    Vec_WecForEachLevel( vGroups, vGroup, g )
+        pCosts[g] = Vec_IntSize(vGroup);
+    pPerm = Abc_MergeSortCost( pCosts, Vec_WecSize(vGroups) );
+    for ( g = Vec_WecSize(vGroups) - 1; g >= 0; g-- )
+    {
+        iBest = 0;
+        for ( i = 1; i < nParts; i++ )
+            if ( Vec_IntSize(Vec_WecEntry(vParts, i)) < Vec_IntSize(Vec_WecEntry(vParts, iBest)) )
+                iBest = i;
+        Vec_IntAppend( Vec_WecEntry(vParts, iBest), Vec_WecEntry(vGroups, pPerm[g]) );
+    }
+    ABC_FREE( pPerm );
+    ABC_FREE( pCosts );
+    Vec_WecFree( vGroups );
+    // remove empty parts and restore the order of the outputs
+    Vec_WecForEachLevel( vParts, vGroup, g )
+        Vec_IntSort( vGroup, 0 );
+    Vec_WecRemoveEmpty( vParts );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the part with the PI mapping.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Saig_BmcMtPart_t * Saig_ManBmcMtPartStart( Saig_BmcMtMan_t * p, Vec_Int_t * vPos )
+{
+    Saig_BmcMtPart_t * pPart;
+    Vec_Int_t * vId2Pi;
+    Aig_Obj_t * pObj;
+    int i;
+    pPart = ABC_CALLOC( Saig_BmcMtPart_t, 1 );
+    pPart->p     = p;
+    pPart->iPart = Vec_PtrSize( p->vParts );
+    pPart->vPos  = Vec_IntDup( vPos );
+    pPart->pAig = Saig_ManDupCones( p->pAig, Vec_IntArray(vPos), Vec_IntSize(vPos) );
+    // the PIs in the cone are marked and point to the new PIs
+    vId2Pi = Vec_IntStartFull( Aig_ManObjNumMax(pPart->pAig) );
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        if ( Aig_ObjIsTravIdCurrent(p->pAig, pObj) )
+            Vec_IntWriteEntry( vId2Pi, Aig_ObjId((Aig_Obj_t *)pObj->pData), i );
+    pPart->vPiMap = Vec_IntAlloc( Saig_ManPiNum(pPart->pAig) );
+    Saig_ManForEachPi( pPart->pAig, pObj, i )
+        Vec_IntPush( pPart->vPiMap, Vec_IntEntry(vId2Pi, Aig_ObjId(pObj)) );
+    Vec_IntFree( vId2Pi );
+    // the parameters of this part
+    pPart->Pars = *p->pPars;
+    pPart->Pars.nThreads    = 0;
+    pPart->Pars.pTele       = NULL;
+    pPart->Pars.nTimeOut    = 0;
+    pPart->Pars.fVerbose    = 0;
+    pPart->Pars.fNotVerbose = 1;
+    pPart->Pars.fSilent     = 1;
+    pPart->Pars.iFrame      = -1;
+    pPart->Pars.nFailOuts   = 0;
+    pPart->Pars.nDropOuts   = 0;
+    pPart->Pars.RunId       = pPart->iPart;
+    pPart->Pars.pFuncStop   = NULL;
+    pPart->Pars.pFuncOnFail = NULL;
+    pPart->Pars.pfStop      = &pPart->fStop;
+    pPart->Pars.pFuncData   = pPart;
+    pPart->Pars.pFuncOnFailData = NULL;
+    pPart->RetValue         = -1;
+    return pPart;
+}
+void Saig_ManBmcMtPartStop( Saig_BmcMtPart_t * pPart )
+{
+    if ( pPart->pAig->vSeqModelVec )
+        Vec_PtrFreeFree( pPart->pAig->vSeqModelVec );
+    pPart->pAig->vSeqModelVec = NULL;
+    Aig_ManStop( pPart->pAig );
+    Vec_IntFree( pPart->vPos );
+    Vec_IntFree( pPart->vPiMap );
+    ABC_FREE( pPart );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the counter-example of the part into the design.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Saig_ManBmcMtRemapCex( Aig_Man_t * p, Saig_BmcMtPart_t * pPart, Abc_Cex_t * pCexPart )
+{
+    Abc_Cex_t * pCex;
+    int f, i;
+    pCex = Abc_CexAlloc( Saig_ManRegNum(p), Saig_ManPiNum(p), pCexPart->iFrame + 1 );
+    pCex->iPo    = Vec_IntEntry( pPart->vPos, pCexPart->iPo );
+    pCex->iFrame = pCexPart->iFrame;
+    for ( f = 0; f <= pCexPart->iFrame; f++ )
+        for ( i = 0; i < pCexPart->nPis; i++ )
+            if ( Abc_InfoHasBit(pCexPart->pData, pCexPart->nRegs + f * pCexPart->nPis + i) )
+                Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + Vec_IntEntry(pPart->vPiMap, i) );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the failed output in the multi-output mode.]
+
+  Description [This procedure is called by the thread whose part contains
+  the failed output. The part is passed as the data of the call back.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcMtCallBackOnFail( void * pData, int iPoPart, Abc_Cex_t * pCexPart )
+{
+    Saig_BmcMtPart_t * pPart = (Saig_BmcMtPart_t *)pData;
+    Saig_BmcMtMan_t * p = pPart->p;
+    Abc_Cex_t * pCex;
+    int iPo, status, fQuit = 0;
+    iPo = Vec_IntEntry( pPart->vPos, iPoPart );
+    pCex = pCexPart ? Saig_ManBmcMtRemapCex( p->pAig, pPart, pCexPart ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    assert( Vec_PtrEntry(p->vCexes, iPo) == NULL );
+    Vec_PtrWriteEntry( p->vCexes, iPo, pCex );
+    if ( !p->pPars->fNotVerbose )
+        Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+            Abc_Base10Log(Saig_ManPoNum(p->pAig)), iPo, pPart->Pars.iFrame + 1,
+            Abc_Base10Log(Saig_ManPoNum(p->pAig)), Saig_ManPoNum(p->pAig) - Vec_PtrCountZero(p->vCexes),
+            Abc_Base10Log(Saig_ManPoNum(p->pAig)), Saig_ManPoNum(p->pAig) );
+    if ( p->pPars->pFuncOnFail && p->pPars->pFuncOnFail(iPo, p->pPars->fStoreCex ? pCex : NULL) )
+    {
+        fQuit = p->fStop = 1;
+        status = pthread_cond_signal( &p->Cond );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    return fQuit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Unrolls and solves the outputs of one part. In the single
+  output mode, the shallowest counter-example is kept.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Saig_ManBmcMtWorkerThread( void * pArg )
+{
+    Saig_BmcMtPart_t * pPart = (Saig_BmcMtPart_t *)pArg;
+    Saig_BmcMtMan_t * p = pPart->p;
+    Abc_Cex_t * pCex;
+    abctime clk = Abc_Clock();
+    int status;
+    if ( pPart->Pars.fSolveAll )
+        pPart->Pars.pFuncOnFailData = Saig_ManBmcMtCallBackOnFail;
+    pPart->RetValue = Saig_ManBmcScalable( pPart->pAig, &pPart->Pars );
+    pCex = (pPart->RetValue == 0 && !pPart->Pars.fSolveAll) ? Saig_ManBmcMtRemapCex( p->pAig, pPart, pPart->pAig->pSeqModel ) : NULL;
+    pPart->clkTotal = Abc_Clock() - clk;
+    status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+    if ( pCex && (p->pCex == NULL || p->pCex->iFrame > pCex->iFrame || (p->pCex->iFrame == pCex->iFrame && p->pCex->iPo > pCex->iPo)) )
+    {
+        ABC_FREE( p->pCex );
+        p->pCex = pCex;
+        p->iFrameCex = pCex->iFrame;
+        pCex = NULL;
+    }
+    p->nRunning--;
+    status = pthread_cond_signal( &p->Cond );  assert( status == 0 );
+    status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+    ABC_FREE( pCex );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine using several threads.]
+
+  Description [The outputs are divided into parts, one for each thread.
+  Each thread unrolls the cones of its outputs and solves them, frame
+  by frame, with its own SAT solver. In the single output mode, when
+  a counter-example is found, the other threads complete the frames
+  up to the frame of the counter-example and stop, so that the shallowest
+  counter-example is returned. The results are returned in the same way
+  as by Saig_ManBmcScalable().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalableMt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Saig_BmcMtMan_t * p;
+    Saig_BmcMtPart_t * pPart;
+    Vec_Wec_t * vParts;
+    Vec_Int_t * vPos;
+    int i, status, nProved = 0, iFrameMax = -1, RetValue = -1;
+    // prepare the shared data
+    p = ABC_CALLOC( Saig_BmcMtMan_t, 1 );
+    p->pAig      = pAig;
+    p->pPars     = pPars;
+    p->vCexes    = pPars->fSolveAll ? Vec_PtrStart( Saig_ManPoNum(pAig) ) : NULL;
+    p->iFrameCex = ABC_INFINITY;
+    p->Deadline  = pPars->nTimeOut ? time(NULL) + pPars->nTimeOut : 0;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );  assert( status == 0 );
+    // derive the parts
+    vParts = Saig_ManBmcMtPartition( pAig, pPars->nThreads );
+    p->vParts = Vec_PtrAlloc( Vec_WecSize(vParts) );
+    Vec_WecForEachLevel( vParts, vPos, i )
+        Vec_PtrPush( p->vParts, Saig_ManBmcMtPartStart(p, vPos) );
+    Vec_WecFree( vParts );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running \"bmc3\" on %d outputs using %d threads. PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n",
+            Saig_ManPoNum(pAig), Vec_PtrSize(p->vParts), Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig) );
+    // start the threads
+    p->nRunning = Vec_PtrSize( p->vParts );
+    Vec_PtrForEachEntry( Saig_BmcMtPart_t *, p->vParts, pPart, i )
+    {
+        status = pthread_create( &pPart->Thread, NULL, Saig_ManBmcMtWorkerThread, (void *)pPart );
+        assert( status == 0 );
+    }
+    Saig_ManBmcMtWaitThreads( p );
+    Vec_PtrForEachEntry( Saig_BmcMtPart_t *, p->vParts, pPart, i )
+    {
+        status = pthread_join( pPart->Thread, NULL );
+        assert( status == 0 );
+    }
+    // collect the results (the parts solved completely do not limit the frame)
+    pPars->iFrame = ABC_INFINITY;
+    pPars->nFailOuts = pPars->nDropOuts = 0;
+    Vec_PtrForEachEntry( Saig_BmcMtPart_t *, p->vParts, pPart, i )
+    {
+        if ( pPart->RetValue != 1 && !(pPart->Pars.fSolveAll && pPart->Pars.nFailOuts + pPart->Pars.nDropOuts >= Vec_IntSize(pPart->vPos)) )
+            pPars->iFrame = Abc_MinInt( pPars->iFrame, pPart->Pars.iFrame );
+        else
+            iFrameMax = Abc_MaxInt( iFrameMax, pPart->Pars.iFrame );
+        pPars->nDropOuts += pPart->Pars.nDropOuts;
+        nProved += (pPart->RetValue == 1);
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Thread %2d : PO =%6d  PI =%6d  FF =%6d  AND =%8d  Frame =%5d  %-9s  ", i,
+                Vec_IntSize(pPart->vPos), Saig_ManPiNum(pPart->pAig), Saig_ManRegNum(pPart->pAig), Aig_ManNodeNum(pPart->pAig),
+                pPart->Pars.iFrame, pPart->RetValue == 1 ? "proved" : (pPart->RetValue == 0 ? "failed" : "undecided") );
+            Abc_PrintTime( 1, "Time", pPart->clkTotal );
+        }
+    }
+    if ( pPars->iFrame == ABC_INFINITY )
+        pPars->iFrame = iFrameMax;
+    if ( pPars->fSolveAll )
+    {
+        pPars->nFailOuts = Saig_ManPoNum(pAig) - Vec_PtrCountZero(p->vCexes);
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = p->vCexes;
+        p->vCexes = NULL;
+    }
+    else if ( p->pCex )
+    {
+        pPars->iFrame = p->pCex->iFrame - 1;
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = p->pCex;
+        p->pCex = NULL;
+    }
+    if ( pPars->nFailOuts || pAig->pSeqModel )
+        RetValue = 0;
+    else if ( nProved == Vec_PtrSize(p->vParts) )
+        RetValue = 1;
+    // cleanup
+    Vec_PtrForEachEntry( Saig_BmcMtPart_t *, p->vParts, pPart, i )
+        Saig_ManBmcMtPartStop( pPart );
+    Vec_PtrFree( p->vParts );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    ABC_FREE( p );
+    fflush( stdout );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -41,6 +41,7 @@ struct Bmc_Mna_t_
     Vec_Int_t *         vOutputs; // outputs of the cone
     Vec_Int_t *         vNodes;   // internal nodes of the cone
     sat_solver *        pSat;     // SAT solver
+    Cnf_Inc_t *         pInc;     // incremental CNF loader
     int                 nSatVars; // the counter of SAT variables
     abctime             clkStart; // starting time
 };
@@ -408,7 +409,10 @@ void Bmc_MnaFree( Bmc_Mna_t * p )
     Vec_IntFreeP( &p->vInputs );
     Vec_IntFreeP( &p->vOutputs );
     Vec_IntFreeP( &p->vNodes );
-    sat_solver_delete( p->pSat );
+    if ( p->pInc )
+        Cnf_IncStop( p->pInc );
+    else
+        sat_solver_delete( p->pSat );
     ABC_FREE( p );
 }
 
@@ -750,8 +754,8 @@ Abc_Cex_t * Gia_ManBmcCexGen( Bmc_Mna_t * pMan, Gia_Man_t * p, int iOut )
         }
         // iOrigPi in iFrame of pGia has PI index iFramePi in pMan->pFrames,
         iObjId = Gia_ObjId( pMan->pFrames, Gia_ManPi(pMan->pFrames, iFramePi) );
-        iSatVar = Vec_IntEntry( pMan->vId2Var, iObjId );
-        if ( sat_solver_var_value(pMan->pSat, iSatVar) )
+        iSatVar = pMan->pInc ? Cnf_IncObjVar( pMan->pInc, iObjId ) : Vec_IntEntry( pMan->vId2Var, iObjId );
+        if ( iSatVar >= 0 && sat_solver_var_value(pMan->pSat, iSatVar) )
             Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p) + Gia_ManPiNum(p) * iFrame + iOrigPi );
         iFramePi++;
     }
@@ -865,51 +869,6 @@ int Gia_ManBmcPerform_old_cnf( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManBmcAddCnfNew_rec( Bmc_Mna_t * p, Gia_Obj_t * pObj )
-{
-    int iObj = Gia_ObjId( p->pFrames, pObj );
-    if ( Gia_ObjIsAnd(pObj) && p->pCnf->pObj2Count[iObj] == -1 )
-    {
-        Gia_ManBmcAddCnfNew_rec( p, Gia_ObjFanin0(pObj) );
-        Gia_ManBmcAddCnfNew_rec( p, Gia_ObjFanin1(pObj) );
-        return;
-    }
-    if ( Vec_IntEntry(p->vId2Var, iObj) > 0 )
-        return;
-    Vec_IntWriteEntry(p->vId2Var, iObj, p->nSatVars++);
-    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsPo(p->pFrames, pObj) )
-    {
-        int i, nClas, iCla;
-        Gia_ManBmcAddCnfNew_rec( p, Gia_ObjFanin0(pObj) );
-        if ( Gia_ObjIsAnd(pObj) )
-        Gia_ManBmcAddCnfNew_rec( p, Gia_ObjFanin1(pObj) );
-        // extend the SAT solver
-        if ( p->nSatVars > sat_solver_nvars(p->pSat) )
-            sat_solver_setnvars( p->pSat, p->nSatVars );
-        // add clauses
-        nClas = p->pCnf->pObj2Count[iObj];
-        iCla  = p->pCnf->pObj2Clause[iObj];
-        for ( i = 0; i < nClas; i++ )
-        {
-            int nLits, pLits[8];
-            int * pClauseThis = p->pCnf->pClauses[iCla+i];
-            int * pClauseNext = p->pCnf->pClauses[iCla+i+1];
-            for ( nLits = 0; pClauseThis + nLits < pClauseNext; nLits++ )
-            {
-                if ( pClauseThis[nLits] < 2 )
-                    printf( "\n\n\nError in CNF generation:  Constant literal!\n\n\n" );
-                assert( pClauseThis[nLits] > 1 && pClauseThis[nLits] < 2*Gia_ManObjNum(p->pFrames) );
-                pLits[nLits] = Abc_Lit2LitV( Vec_IntArray(p->vId2Var), pClauseThis[nLits] );
-            }
-            assert( nLits < 8 );
-            if ( !sat_solver_addclause( p->pSat, pLits, pLits + nLits ) )
-                break;
-        }
-        if ( i < nClas )
-            printf( "SAT solver became UNSAT after adding clauses.\n" );
-    }
-    else assert( Gia_ObjIsCi(pObj) );
-}
 void Gia_ManBmcAddCnfNew( Bmc_Mna_t * p, int iStart, int iStop )
 {
     Gia_Obj_t * pObj;
@@ -919,7 +878,7 @@ void Gia_ManBmcAddCnfNew( Bmc_Mna_t * p, int iStart, int iStop )
         pObj = Gia_ManPo(p->pFrames, i);
         if ( Gia_ObjFanin0(pObj) == Gia_ManConst0(p->pFrames) )
             continue;
-        Gia_ManBmcAddCnfNew_rec( p, pObj );
+        Cnf_IncLoadCo( p->pInc, i );
     }
 }
 
@@ -959,8 +918,8 @@ int Gia_ManBmcPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Gia_Man_t * pTemp;
     int nFramesMax, f, i=0, Lit = 1, status, RetValue = -2;
     abctime clk = Abc_Clock();
+    abctime nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
     p = Bmc_MnaAlloc();
-    sat_solver_set_runtime_limit( p->pSat, pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
     p->pFrames = Gia_ManBmcUnroll( pGia, pPars->nFramesMax, pPars->nFramesAdd, pPars->fVeryVerbose, &p->vPiMap );
     nFramesMax = Gia_ManPoNum(p->pFrames) / Gia_ManPoNum(pGia);
     if ( pPars->fVerbose )
@@ -986,13 +945,18 @@ int Gia_ManBmcPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         p->pFrames = Jf_ManDeriveCnf( pTemp = p->pFrames );  Gia_ManStop( pTemp );
         p->pCnf = (Cnf_Dat_t *)p->pFrames->pData; p->pFrames->pData = NULL;
     }
-    Vec_IntFillExtra( p->vId2Var, Gia_ManObjNum(p->pFrames), 0 );
-    // create clauses for constant node
-//    sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    // the timeframes are loaded into the solver on demand
+    sat_solver_delete( p->pSat );
+    p->pInc = Cnf_IncStart( p->pFrames, p->pCnf, NULL, pPars->nSatVarMax );
+    p->pSat = Cnf_IncSolver( p->pInc );
+    sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
     for ( f = 0; f < nFramesMax; f++ )
     {
         if ( !Gia_ManBmcCheckOutputs( p->pFrames, f * Gia_ManPoNum(pGia), (f+1) * Gia_ManPoNum(pGia) ) )
         {
+            // restart the solver before the slice if it has grown too large
+            if ( Cnf_IncRecycle( p->pInc ) && pPars->fVerbose )
+                printf( "Recycled the SAT solver before frame %d.\n", f );
             // create another slice
             Gia_ManBmcAddCnfNew( p, f * Gia_ManPoNum(pGia), (f+1) * Gia_ManPoNum(pGia) );
             // try solving the outputs
@@ -1006,7 +970,7 @@ int Gia_ManBmcPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     printf( "Output %d is trivially SAT.\n", i );
                     continue;
                 }
-                Lit = Abc_Var2Lit( Vec_IntEntry(p->vId2Var, Gia_ObjId(p->pFrames, pObj)), 0 );
+                Lit = Cnf_IncLoadCo( p->pInc, i );
                 status = sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
                 if ( status == l_False ) // unsat
                     continue;
@@ -1021,7 +985,7 @@ int Gia_ManBmcPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
             {
                 printf( "%4d :  PI =%9d.  AIG =%9d.  Var =%8d.  In =%6d.  And =%9d.  Cla =%9d.  Conf =%9d.  Mem =%7.1f MB   ", 
                     f, Gia_ManPiNum(p->pFrames), Gia_ManAndNum(p->pFrames), 
-                    p->nSatVars-1, Vec_IntSize(p->vInputs), Vec_IntSize(p->vNodes), 
+                    Cnf_IncVarNum(p->pInc), Vec_IntSize(p->vInputs), Vec_IntSize(p->vNodes), 
                     sat_solver_nclauses(p->pSat), sat_solver_nconflicts(p->pSat), Gia_ManMemory(p->pFrames)/(1<<20) );
                 Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
             }
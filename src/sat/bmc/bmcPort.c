@@ -0,0 +1,439 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Multi-threaded portfolio of sequential verification engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcPort.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "aig/gia/giaAig.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "proof/ssw/ssw.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// engines raced in the portfolio
+#define BMC_PORT_PDR   0   // property directed reachability
+#define BMC_PORT_BMC   1   // bounded model checking (bmc3)
+#define BMC_PORT_INT   2   // interpolation
+#define BMC_PORT_IND   3   // induction using signal correspondence
+#define BMC_PORT_NUM   4
+
+static char * s_BmcPortNames[BMC_PORT_NUM] = { "pdr", "bmc3", "int", "ind" };
+
+// information given to the thread
+typedef struct Bmc_PortThData_t_ Bmc_PortThData_t;
+struct Bmc_PortThData_t_
+{
+    Aig_Man_t * pAig;       // private copy of the design
+    int         Engine;     // the engine to run
+    int         Variant;    // the parameter variant of the engine
+    int         RunId;      // the portfolio run this thread belongs to
+    int         nTimeOut;   // timeout in seconds
+    int         RetValue;   // 1 = proved; 0 = disproved; -1 = undecided
+    int         iFrame;     // the last frame explored
+    int         fWinner;    // set to 1 if this thread produced the verdict
+    int         fCancelled; // set to 1 if this thread was stopped by another one
+    abctime     clkTotal;   // runtime of this thread
+    Abc_Cex_t * pCex;       // counter-example if disproved
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets default parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortSetDefaultParams( Bmc_PortPar_t * p )
+{
+    memset( p, 0, sizeof(Bmc_PortPar_t) );
+    p->nThreads       =     4;    // the number of concurrent engines
+    p->nTimeOut       =     0;    // approximate timeout in seconds
+    p->fUsePdr        =     1;    // race property directed reachability
+    p->fUseBmc        =     1;    // race bounded model checking
+    p->fUseInt        =     1;    // race interpolation
+    p->fUseInd        =     1;    // race induction
+    p->fVerbose       =     0;    // verbose
+    p->iEngine        =    -1;    // the engine that produced the verdict
+    p->iFrame         =    -1;    // explored up to this frame
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns engines and their variants to the threads.]
+
+  Description [The first threads run one instance of each enabled engine.
+  The remaining threads run diversified variants of PDR, BMC and induction.
+  Interpolation is started at most once because it relies on the global
+  CNF manager and the rewriting library, which are not reentrant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Bmc_PortAssignEngines( Gia_Man_t * p, Bmc_PortPar_t * pPars )
+{
+    Vec_Int_t * vEngines = Vec_IntAlloc( 2 * pPars->nThreads );
+    int pUse[BMC_PORT_NUM], pVariants[BMC_PORT_NUM] = {0};
+    int i, nUsed = 0;
+    pUse[BMC_PORT_PDR] = pPars->fUsePdr;
+    pUse[BMC_PORT_BMC] = pPars->fUseBmc;
+    pUse[BMC_PORT_INT] = pPars->fUseInt && Gia_ManRegNum(p) > 0 && Gia_ManPiNum(p) > 0 && p->nConstrs == 0;
+    pUse[BMC_PORT_IND] = pPars->fUseInd && Gia_ManRegNum(p) > 0 && p->nConstrs == 0;
+    for ( i = 0; i < BMC_PORT_NUM; i++ )
+        nUsed += pUse[i];
+    if ( nUsed == 0 )
+        return vEngines;
+    // add one instance of each engine
+    for ( i = 0; i < BMC_PORT_NUM && Vec_IntSize(vEngines) < 2 * pPars->nThreads; i++ )
+        if ( pUse[i] )
+        {
+            Vec_IntPush( vEngines, i );
+            Vec_IntPush( vEngines, pVariants[i]++ );
+        }
+    // fill the remaining threads with variants
+    if ( nUsed == 1 && pUse[BMC_PORT_INT] )
+        return vEngines;
+    for ( i = 0; Vec_IntSize(vEngines) < 2 * pPars->nThreads; i = (i + 1) % BMC_PORT_NUM )
+        if ( pUse[i] && i != BMC_PORT_INT )
+        {
+            Vec_IntPush( vEngines, i );
+            Vec_IntPush( vEngines, pVariants[i]++ );
+        }
+    return vEngines;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Gia_ManPortfolioProve( Gia_Man_t * p, Bmc_PortPar_t * pPars )
+{
+    Abc_Print( -1, "The portfolio prover requires ABC to be compiled with pthreads.\n" );
+    return -1;
+}
+
+#else // pthreads are used
+
+// mutex to control access to shared variables
+static pthread_mutex_t g_PortMutex = PTHREAD_MUTEX_INITIALIZER;
+static volatile int g_nPortRunIds = 0;  // the number of the last portfolio run
+
+// call back procedure for the engines
+int Bmc_PortCallBackToStop( int RunId ) { assert( RunId <= g_nPortRunIds ); return RunId < g_nPortRunIds; }
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine.]
+
+  Description [Returns 1 if proved, 0 if disproved, -1 if undecided.
+  Derived counter-example (if any) is saved in the thread data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortRunPdr( Bmc_PortThData_t * pThData )
+{
+    Pdr_Par_t Pars, * pPars = &Pars;
+    int RetValue;
+    Pdr_ManSetDefaultParams( pPars );
+    pPars->nTimeOut     = pThData->nTimeOut;
+    pPars->fTwoRounds   = (pThData->Variant % 4) == 1;
+    pPars->fSkipGeneral = (pThData->Variant % 4) == 2;
+    pPars->fShortest    = (pThData->Variant % 4) == 3;
+    pPars->nRecycle     = 300 * (1 + pThData->Variant / 4);
+    pPars->fSilent      = 1;
+    pPars->RunId        = pThData->RunId;
+    pPars->pFuncStop    = Bmc_PortCallBackToStop;
+    RetValue = Pdr_ManSolve( pThData->pAig, pPars );
+    pThData->iFrame = pPars->iFrame;
+    return RetValue;
+}
+int Bmc_PortRunBmc( Bmc_PortThData_t * pThData )
+{
+    Saig_ParBmc_t Pars, * pPars = &Pars;
+    int RetValue;
+    Saig_ParBmcSetDefaultParams( pPars );
+    pPars->nTimeOut      = pThData->nTimeOut;
+    pPars->nLearnedStart = pPars->nLearnedStart * (1 + pThData->Variant);
+    pPars->fSkipRand     = pThData->Variant & 1;
+    pPars->fSilent       = 1;
+    pPars->fNotVerbose   = 1;
+    pPars->RunId         = pThData->RunId;
+    pPars->pFuncStop     = Bmc_PortCallBackToStop;
+    RetValue = Saig_ManBmcScalable( pThData->pAig, pPars );
+    pThData->iFrame = pPars->iFrame;
+    return RetValue;
+}
+int Bmc_PortRunInt( Bmc_PortThData_t * pThData )
+{
+    Inter_ManParams_t Pars, * pPars = &Pars;
+    Aig_Man_t * pMiter;
+    int RetValue, iFrame = -1;
+    // interpolation works on single-output designs
+    if ( Saig_ManPoNum(pThData->pAig) > 1 )
+        pMiter = Saig_ManDupOrpos( pThData->pAig );
+    else
+        pMiter = Aig_ManDupSimple( pThData->pAig );
+    Inter_ManSetDefaultParams( pPars );
+    pPars->nSecLimit = pThData->nTimeOut;
+    pPars->fSilent   = 1;
+    pPars->RunId     = pThData->RunId;
+    pPars->pFuncStop = Bmc_PortCallBackToStop;
+    RetValue = Inter_ManPerformInterpolation( pMiter, pPars, &iFrame );
+    pThData->iFrame = pPars->iFrameMax;
+    if ( RetValue == 0 && pMiter->pSeqModel )
+    {
+        // map the failure of the combined output back into the original output
+        ABC_FREE( pThData->pAig->pSeqModel );
+        pThData->pAig->pSeqModel = pMiter->pSeqModel;
+        pThData->pAig->pSeqModel->iPo = Saig_ManFindFailedPoCex( pThData->pAig, pMiter->pSeqModel );
+        pMiter->pSeqModel = NULL;
+    }
+    Aig_ManStop( pMiter );
+    return RetValue;
+}
+int Bmc_PortRunInd( Bmc_PortThData_t * pThData )
+{
+    Ssw_Pars_t Pars, * pPars = &Pars;
+    Aig_Man_t * pAig, * pNew;
+    Aig_Obj_t * pObj;
+    abctime nTimeToStop = pThData->nTimeOut ? pThData->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    int i, k, RetValue = -1;
+    // increase the induction depth while reducing the design
+    pAig = Aig_ManDupSimple( pThData->pAig );
+    for ( k = 1 + pThData->Variant; k <= 64 && Aig_ManRegNum(pAig) > 0; k *= 2 )
+    {
+        if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+            break;
+        Ssw_ManSetDefaultParams( pPars );
+        pPars->nFramesK  = k;
+        pPars->TimeLimit = nTimeToStop ? Abc_MaxInt( 1, (int)((nTimeToStop - Abc_Clock()) / CLOCKS_PER_SEC) ) : 0;
+        pPars->RunId     = pThData->RunId;
+        pPars->pFuncStop = Bmc_PortCallBackToStop;
+        pNew = Ssw_SignalCorrespondence( pAig, pPars );
+        Aig_ManStop( pAig );
+        pAig = pNew;
+        // the reduced AIG is not valid if the computation was cancelled
+        if ( Bmc_PortCallBackToStop( pThData->RunId ) )
+            break;
+        pThData->iFrame = k;
+        // the property holds if all outputs are reduced to constant 0
+        Saig_ManForEachPo( pAig, pObj, i )
+            if ( Aig_ObjChild0(pObj) != Aig_ManConst0(pAig) )
+                break;
+        if ( i == Saig_ManPoNum(pAig) )
+        {
+            RetValue = 1;
+            break;
+        }
+    }
+    Aig_ManStop( pAig );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine of the portfolio.]
+
+  Description [The engines run silently. Their results are reported by
+  the calling thread after all threads have quit, so that the output of
+  different threads is not interleaved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Bmc_PortWorkerThread( void * pArg )
+{
+    Bmc_PortThData_t * pThData = (Bmc_PortThData_t *)pArg;
+    int RetValue = -1, status;
+    abctime clk = Abc_Clock();
+    if ( pThData->Engine == BMC_PORT_PDR )
+        RetValue = Bmc_PortRunPdr( pThData );
+    else if ( pThData->Engine == BMC_PORT_BMC )
+        RetValue = Bmc_PortRunBmc( pThData );
+    else if ( pThData->Engine == BMC_PORT_INT )
+        RetValue = Bmc_PortRunInt( pThData );
+    else if ( pThData->Engine == BMC_PORT_IND )
+        RetValue = Bmc_PortRunInd( pThData );
+    else assert( 0 );
+    // disproved without a counter-example is treated as undecided
+    if ( RetValue == 0 && pThData->pAig->pSeqModel == NULL )
+        RetValue = -1;
+    // the first engine to deliver a verdict cancels all others
+    status = pthread_mutex_lock(&g_PortMutex);  assert( status == 0 );
+    if ( RetValue != -1 && pThData->RunId == g_nPortRunIds )
+    {
+        pThData->fWinner = 1;
+        g_nPortRunIds++;
+    }
+    status = pthread_mutex_unlock(&g_PortMutex);  assert( status == 0 );
+    pThData->RetValue   = RetValue;
+    pThData->fCancelled = RetValue == -1 && Bmc_PortCallBackToStop(pThData->RunId);
+    pThData->clkTotal   = Abc_Clock() - clk;
+    if ( RetValue == 0 )
+    {
+        pThData->pCex = pThData->pAig->pSeqModel;
+        pThData->pAig->pSeqModel = NULL;
+    }
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Races several engines against the same design.]
+
+  Description [Returns 1 if the property is proved, 0 if disproved
+  (the counter-example is stored in p->pCexSeq), -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManPortfolioProve( Gia_Man_t * p, Bmc_PortPar_t * pPars )
+{
+    Bmc_PortThData_t * pThData;
+    pthread_t * pThreads;
+    Vec_Int_t * vEngines;
+    int i, nThreads, RunId, status, RetValue = -1;
+    pPars->iEngine = -1;
+    pPars->iFrame  = -1;
+    vEngines = Bmc_PortAssignEngines( p, pPars );
+    nThreads = Vec_IntSize(vEngines) / 2;
+    if ( nThreads == 0 )
+    {
+        Vec_IntFree( vEngines );
+        Abc_Print( 1, "No engines are applicable to the current design.\n" );
+        return -1;
+    }
+    // start a new run
+    status = pthread_mutex_lock(&g_PortMutex);  assert( status == 0 );
+    RunId = ++g_nPortRunIds;
+    status = pthread_mutex_unlock(&g_PortMutex);  assert( status == 0 );
+    // collect thread data (each engine works on its own copy of the design)
+    pThData  = ABC_CALLOC( Bmc_PortThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].pAig     = Gia_ManToAigSimple( p );
+        pThData[i].Engine   = Vec_IntEntry( vEngines, 2*i );
+        pThData[i].Variant  = Vec_IntEntry( vEngines, 2*i+1 );
+        pThData[i].RunId    = RunId;
+        pThData[i].nTimeOut = pPars->nTimeOut;
+        pThData[i].RetValue = -1;
+    }
+    Vec_IntFree( vEngines );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running portfolio with %d threads:", nThreads );
+        for ( i = 0; i < nThreads; i++ )
+            Abc_Print( 1, " %s(%d)", s_BmcPortNames[pThData[i].Engine], pThData[i].Variant );
+        Abc_Print( 1, "\n" );
+    }
+    // create threads
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Bmc_PortWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    // wait till all threads have quit (they stop soon after the verdict is known)
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    // collect the result
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( pPars->fVerbose )
+        {
+            char * pResult = pThData[i].RetValue == 1 ? "proved" : pThData[i].RetValue == 0 ? "disproved" : pThData[i].fCancelled ? "cancelled" : "undecided";
+            Abc_Print( 1, "Engine %-4s (variant %d) %-9s %-5s  Time = %9.2f sec\n", s_BmcPortNames[pThData[i].Engine], pThData[i].Variant,
+                pResult, pThData[i].fWinner ? "first" : "", 1.0*pThData[i].clkTotal/CLOCKS_PER_SEC );
+        }
+        if ( pThData[i].fWinner )
+        {
+            RetValue = pThData[i].RetValue;
+            pPars->iEngine = pThData[i].Engine;
+            pPars->iFrame  = pThData[i].iFrame;
+            if ( RetValue == 0 )
+            {
+                Abc_CexFreeP( &p->pCexSeq );
+                p->pCexSeq = pThData[i].pCex;
+                pThData[i].pCex = NULL;
+                if ( !Gia_ManVerifyCex( p, p->pCexSeq, 0 ) )
+                    Abc_Print( 1, "Counter-example verification has FAILED.\n" );
+            }
+        }
+        else if ( RetValue == -1 )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, pThData[i].iFrame );
+        Abc_CexFreeP( &pThData[i].pCex );
+        Aig_ManStop( pThData[i].pAig );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pThData );
+    if ( pPars->fVerbose )
+    {
+        if ( RetValue == -1 )
+            Abc_Print( 1, "None of the engines produced a verdict.\n" );
+        else
+            Abc_Print( 1, "Property is %s by engine \"%s\".\n", RetValue ? "proved" : "disproved", s_BmcPortNames[pPars->iEngine] );
+    }
+    return RetValue;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
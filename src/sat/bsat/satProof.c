@@ -211,14 +211,14 @@ Vec_Int_t * Proof_CollectUsedRec( Vec_Set_t * vProof, Vec_Int_t * vRoots )
 
   Synopsis    [Recursively visits useful proof nodes.]
 
-  Description []
+  Description [Only visits the nodes whose handles are not less than hYoung.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Proof_MarkUsed_rec( Vec_Set_t * vProof, int hNode )
+int Proof_MarkUsed_rec( Vec_Set_t * vProof, int hNode, int hYoung )
 {
     satset * pNext, * pNode = Proof_NodeRead( vProof, hNode );
     int i, Counter = 1;
@@ -226,16 +226,16 @@ int Proof_MarkUsed_rec( Vec_Set_t * vProof, int hNode )
         return 0;
     pNode->Id = 1;
     Proof_NodeForeachFanin( vProof, pNode, pNext, i )
-        if ( pNext && !pNext->Id )
-            Counter += Proof_MarkUsed_rec( vProof, pNode->pEnts[i] >> 2 );
+        if ( pNext && !pNext->Id && (pNode->pEnts[i] >> 2) >= hYoung )
+            Counter += Proof_MarkUsed_rec( vProof, pNode->pEnts[i] >> 2, hYoung );
     return Counter;
 }
-int Proof_MarkUsedRec( Vec_Set_t * vProof, Vec_Int_t * vRoots )
+int Proof_MarkUsedRec( Vec_Set_t * vProof, Vec_Int_t * vRoots, int hYoung )
 {
     int i, Entry, Counter = 0;
     Vec_IntForEachEntry( vRoots, Entry, i )
-        if ( Entry >= 0 )
-            Counter += Proof_MarkUsed_rec( vProof, Entry );
+        if ( Entry >= hYoung )
+            Counter += Proof_MarkUsed_rec( vProof, Entry, hYoung );
     return Counter;
 }
 
@@ -380,7 +380,23 @@ void Sat_ProofCheck0( Vec_Set_t * vProof )
     }
 }
 
-int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
+/**Function*************************************************************
+
+  Synopsis    [Removes the proof nodes that are not used by the roots.]
+
+  Description [Only the young generation of the nodes (the ones whose handles 
+  are not less than hYoung) is collected and compacted; the old nodes are 
+  neither visited nor moved, and the handles pointing to them do not change.
+  Since the fanins of a node are always older than the node, a young node 
+  is never used by an old one.  With hYoung equal to 2, the complete proof 
+  is collected.  Updates the handles of the roots and returns the new pivot.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ProofReduceYoung( Vec_Set_t * vProof, void * pRoots, int hProofPivot, int hYoung )
 {
 //    Vec_Set_t * vProof   = (Vec_Set_t *)&s->Proofs;
 //    Vec_Int_t * vRoots   = (Vec_Int_t *)&s->claProofs;
@@ -388,21 +404,24 @@ int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
 //    Vec_Int_t * vClauses = (Vec_Int_t *)&s->clauses;
     int fVerbose = 0;
     Vec_Ptr_t * vUsed;
-    satset * pNode, * pFanin, * pPivot;
+    satset * pNode, * pFanin;
     int i, j, k, hTemp, nSize;
     abctime clk = Abc_Clock();
     static abctime TimeTotal = 0;
     int RetValue;
 //Sat_ProofCheck0( vProof );
 
+    assert( hYoung >= 2 && hYoung <= Vec_SetHandCurrent(vProof) );
     // collect visited nodes
-    nSize = Proof_MarkUsedRec( vProof, vRoots );
+    nSize = Proof_MarkUsedRec( vProof, vRoots, hYoung );
     vUsed = Vec_PtrAlloc( nSize );
 //Sat_ProofCheck0( vProof );
 
     // relabel nodes to use smaller space
-    Vec_SetShrinkS( vProof, 2 );
-    Vec_SetForEachEntry( satset *, vProof, nSize, pNode, i, j )
+    assert( hProofPivot >= 1 && hProofPivot <= Vec_SetHandCurrent(vProof) );
+    RetValue = hProofPivot < hYoung ? hProofPivot : -1;
+    Vec_SetShrinkS( vProof, hYoung );
+    Vec_SetForEachEntryStart( satset *, vProof, nSize, pNode, i, j, hYoung )
     {
         nSize = Vec_SetWordNum( 2 + pNode->nEnts );
         if ( pNode->Id == 0 ) 
@@ -410,9 +429,13 @@ int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
         pNode->Id = Vec_SetAppendS( vProof, 2 + pNode->nEnts );
         assert( pNode->Id > 0 );
         Vec_PtrPush( vUsed, pNode );
+        // the new pivot is the first useful node at or after the old pivot
+        // (the handles are compared because the pages are not ordered in memory)
+        if ( RetValue == -1 && (i << vProof->nPageSize) + j >= hProofPivot )
+            RetValue = pNode->Id;
         // update fanins
         Proof_NodeForeachFanin( vProof, pNode, pFanin, k )
-            if ( (pNode->pEnts[k] & 1) == 0 ) // proof node
+            if ( (pNode->pEnts[k] & 1) == 0 && (pNode->pEnts[k] >> 2) >= hYoung ) // young proof node
             {
                 assert( pFanin->Id > 0 );
                 pNode->pEnts[k] = (pFanin->Id << 2) | (pNode->pEnts[k] & 2);
@@ -422,21 +445,16 @@ int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
     }
     // update roots
     Proof_ForeachNodeVec1( vRoots, vProof, pNode, i )
-        Vec_IntWriteEntry( vRoots, i, pNode->Id );
-    // determine new pivot
-    assert( hProofPivot >= 1 && hProofPivot <= Vec_SetHandCurrent(vProof) );
-    pPivot = Proof_NodeRead( vProof, hProofPivot );
-    RetValue = Vec_SetHandCurrentS(vProof);
+        if ( Vec_IntEntry(vRoots, i) >= hYoung )
+            Vec_IntWriteEntry( vRoots, i, pNode->Id );
+    // if there are no useful nodes after the pivot, it points to the end
+    if ( RetValue == -1 )
+        RetValue = Vec_SetHandCurrentS(vProof);
     // compact the nodes
     Vec_PtrForEachEntry( satset *, vUsed, pNode, i )
     {
         hTemp = pNode->Id; pNode->Id = 0;
         memmove( Vec_SetEntry(vProof, hTemp), pNode, sizeof(word)*Proof_NodeWordNum(pNode->nEnts) );
-        if ( pPivot && pPivot <= pNode )
-        {
-            RetValue = hTemp;
-            pPivot = NULL;
-        }
     }
     Vec_SetWriteEntryNum( vProof, Vec_PtrSize(vUsed) );
     Vec_PtrFree( vUsed );
@@ -452,12 +470,16 @@ int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
         Abc_PrintTime( 1, "Time", TimeTotal );
     }
     Vec_SetShrink( vProof, Vec_SetHandCurrentS(vProof) );
-    Vec_SetShrinkLimits( vProof );
+    Vec_SetShrinkLimitsStart( vProof, hYoung );
 //    Sat_ProofReduceCheck( s );
 //Sat_ProofCheck0( vProof );
 
     return RetValue;
 }
+int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
+{
+    return Sat_ProofReduceYoung( vProof, pRoots, hProofPivot, 2 );
+}
 
 #if 0
 
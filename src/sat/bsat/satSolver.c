@@ -132,6 +132,19 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// The watch list of a literal contains two kinds of entries. A binary clause
+// is one odd entry (the other literal, see clause_from_lit()). A longer clause
+// is two entries: the handle (always even) followed by the blocker, which is
+// a literal of the clause. If the blocker is true, the clause is satisfied
+// and the propagation skips it without reading the clause from memory.
+static inline void     sat_solver_watch_push(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s, l);
+    assert( !clause_is_lit(h) );
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -453,8 +466,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch_push(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch_push(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -587,6 +608,9 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    // share units and glue clauses with other solvers
+    if ( s->pFuncExport && (h == 0 || clause_read(s, h)->lbd <= 2) )
+        s->pFuncExport( s->pShareData, begin, end );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -943,7 +967,17 @@ int sat_solver_propagate(sat_solver* s)
                 }
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit blocker = i[1];
+
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -955,8 +989,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -965,23 +1001,28 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch_push(s, lit_neg(lits[1]), *i, lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
+            next:
+                i += 2;
+                continue;
             }
-        next:
             i++;
         }
 
@@ -1229,6 +1270,9 @@ void sat_solver_restart( sat_solver* s )
     s->stats.learnts          = 0;
     s->stats.learnts_literals = 0;
     s->stats.tot_literals     = 0;
+    s->timeSearch             = 0;
+    s->timeAnalyze            = 0;
+    s->timeReduce             = 0;
 }
 
 // returns memory in bytes used by the SAT solver
@@ -1288,7 +1332,7 @@ void sat_solver_reducedb(sat_solver* s)
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
     int * pPerm, * pArray, * pSortValues, nCutoffValue;
-    int i, k, j, Id, Counter, CounterStart, nSelected;
+    int i, k, j, Id, Counter, CounterStart, nSelected, nStep;
     clause * c;
 
     assert( s->nLearntMax > 0 );
@@ -1365,17 +1409,25 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        // the step is read before the entry is moved, because the move may overwrite pArray[k]
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += nStep )
         {
+            nStep = sat_solver_watch_size(pArray[k]);
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1387,6 +1439,7 @@ void sat_solver_reducedb(sat_solver* s)
 
     // report the results
     TimeTotal += Abc_Clock() - clk;
+    s->timeReduce += Abc_Clock() - clk;
     if ( s->fVerbose )
     {
     Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
@@ -1400,7 +1453,7 @@ void sat_solver_reducedb(sat_solver* s)
 void sat_solver_rollback( sat_solver* s )
 {
     Sat_Mem_t * pMem = &s->Mem;
-    int i, k, j;
+    int i, k, j, nStep;
     static int Count = 0;
     Count++;
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
@@ -1429,9 +1482,16 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += nStep )
+        {
+            nStep = sat_solver_watch_size(pArray[k]);
             if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                if ( nStep == 2 )
+                    pArray[j++] = pArray[k+1];
+            }
+        }
         veci_resize(&s->wlists[i],j);
     }
     // reset watcher lists
@@ -1479,6 +1539,9 @@ void sat_solver_rollback( sat_solver* s )
         s->stats.learnts          = 0;
         s->stats.learnts_literals = 0;
         s->stats.tot_literals     = 0;
+        s->timeSearch             = 0;
+        s->timeAnalyze            = 0;
+        s->timeReduce             = 0;
 
         // initialize rollback
         s->iVarPivot              =  0; // the pivot for variables
@@ -1564,6 +1627,37 @@ void luby_test()
     printf( "\n" );
 }
 
+// adds clauses learned by other solvers at the top level; returns 0 if UNSAT
+static int sat_solver_import(sat_solver* s)
+{
+    veci    lits;
+    lit *   begin;
+    int     i, k, RetValue = 1;
+    assert( sat_solver_dl(s) == 0 );
+    veci_new(&lits);
+    while ( RetValue && s->pFuncImport(s->pShareData, &lits) )
+    {
+        begin = veci_begin(&lits);
+        for ( i = k = 0; i < veci_size(&lits); i++ )
+        {
+            if ( lit_var(begin[i]) >= s->size || var_value(s, lit_var(begin[i])) == lit_sign(begin[i]) )
+                break;
+            if ( var_value(s, lit_var(begin[i])) == varX )
+                begin[k++] = begin[i];
+        }
+        if ( i < veci_size(&lits) ) // satisfied clause
+            continue;
+        if ( k == 0 )
+            RetValue = 0;
+        else if ( k == 1 )
+            RetValue = sat_solver_enqueue(s, begin[0], 0) && sat_solver_propagate(s) == 0;
+        else
+            sat_solver_clause_new(s, begin, begin + k, 1);
+    }
+    veci_delete(&lits);
+    return RetValue;
+}
+
 static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
 {
 //    double  var_decay       = 0.95;
@@ -1613,7 +1707,14 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             }
 
             veci_resize(&learnt_clause,0);
-            sat_solver_analyze(s, hConfl, &learnt_clause);
+            if ( s->fTelemetry )
+            {
+                abctime clk = Abc_Clock();
+                sat_solver_analyze(s, hConfl, &learnt_clause);
+                s->timeAnalyze += Abc_Clock() - clk;
+            }
+            else
+                sat_solver_analyze(s, hConfl, &learnt_clause);
             blevel = veci_size(&learnt_clause) > 1 ? var_level(s, lit_var(veci_begin(&learnt_clause)[1])) : s->root_level;
             blevel = s->root_level > blevel ? s->root_level : blevel;
             sat_solver_canceluntil(s,blevel);
@@ -1631,7 +1732,8 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
  
             // Reached bound on number of conflicts:
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) ||
+                (s->pFuncStop && (s->stats.conflicts & 63) == 0 && s->pFuncStop(s->RunId)) || (s->pStop && *s->pStop)){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1857,8 +1959,23 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
                 s->progress_estimate*100);
             fflush(stdout);
         }
-        nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
-        status = sat_solver_search(s, nof_conflicts);
+        if ( s->pFuncImport && s->root_level == 0 && !sat_solver_import(s) )
+        {
+            status = l_False;
+            break;
+        }
+        if ( s->fGeomRestart )
+            nof_conflicts = (ABC_INT64_T)( (s->nRestartBase ? s->nRestartBase : 100) * pow(1.5, Abc_MinInt(restart_iter++, 64)) );
+        else
+            nof_conflicts = (ABC_INT64_T)( (s->nRestartBase ? s->nRestartBase : 100) * luby(2, restart_iter++) );
+        if ( s->fTelemetry )
+        {
+            abctime clk = Abc_Clock();
+            status = sat_solver_search(s, nof_conflicts);
+            s->timeSearch += Abc_Clock() - clk;
+        }
+        else
+            status = sat_solver_search(s, nof_conflicts);
 //        nof_learnts    = nof_learnts * 11 / 10; //*= 1.1;
         // quit the loop if reached an external limit
         if ( s->nConfLimit && s->stats.conflicts > s->nConfLimit )
@@ -1867,6 +1984,10 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
             break;
         if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
             break;
+        if ( s->pFuncStop && s->pFuncStop(s->RunId) )
+            break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
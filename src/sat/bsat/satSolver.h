@@ -63,8 +63,12 @@ extern int         sat_solver_get_var_value(sat_solver* s, int v);
 
 extern void        Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumptionsBegin, lit* assumptionsEnd, int incrementVars );
 extern void        Sat_SolverPrintStats( FILE * pFile, sat_solver * p );
+extern void        Sat_SolverTeleCollect( sat_solver * p, Sat_Tele_t * pTele );
+extern void        Sat_TelePrint( FILE * pFile, Sat_Tele_t * p );
+extern int         Sat_TeleDumpJson( Sat_Tele_t * p, char * pFileName, char * pEngine );
 extern int *       Sat_SolverGetModel( sat_solver * p, int * pVars, int nVars );
 extern void        Sat_SolverDoubleClauses( sat_solver * p, int iVar );
+extern int         Sat_SolverRollbackTest();
 
 // trace recording
 extern void        Sat_SolverTraceStart( sat_solver * pSat, char * pName );
@@ -152,8 +156,12 @@ struct sat_solver_t
     double      progress_estimate;
     int         verbosity;     // Verbosity level. 0=silent, 1=some progress report, 2=everything
     int         fVerbose;
+    int         fTelemetry;    // measure the runtime of solver phases
 
     stats_t     stats;
+    abctime     timeSearch;    // runtime of the search (if fTelemetry is set)
+    abctime     timeAnalyze;   // runtime of conflict analysis (if fTelemetry is set)
+    abctime     timeReduce;    // runtime of learned clause reduction (if fTelemetry is set)
     int         nLearntMax;    // max number of learned clauses
     int         nLearntStart;  // starting learned clause limit
     int         nLearntDelta;  // delta of learned clause limit
@@ -163,6 +171,16 @@ struct sat_solver_t
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
     abctime     nRuntimeLimit; // external limit on runtime
+    int         RunId;         // SAT id in this run
+    int(*pFuncStop)(int);      // callback to terminate
+    volatile int * pStop;      // terminates when this flag is set (if not NULL)
+
+    // portfolio solving
+    int         fGeomRestart;  // use geometric restarts instead of Luby restarts
+    int         nRestartBase;  // the number of conflicts before the first restart (0 = default)
+    void *      pShareData;    // clause sharing data of this solver
+    void(*pFuncExport)(void *, lit *, lit *); // callback to export a learned clause with LBD <= 2
+    int(*pFuncImport)(void *, veci *);        // callback to import one clause learned by other solvers
 
     veci        act_vars;      // variables whose activity has changed
     double*     factors;       // the activity factors
@@ -196,6 +214,12 @@ static inline clause * clause_read( sat_solver * s, cla h )
     return Sat_MemClauseHand( &s->Mem, h );      
 }
 
+// the number of watch list entries taken by a watcher (see sat_solver_watch_push())
+static inline int sat_solver_watch_size( cla h )
+{
+    return clause_is_lit(h) ? 1 : 2;
+}
+
 static int sat_solver_var_value( sat_solver* s, int v )
 {
     assert( v >= 0 && v < s->size );
@@ -1034,7 +1034,14 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             }
 
             veci_resize(&learnt_clause,0);
-            proof_id = solver2_analyze(s, confl, &learnt_clause);
+            if ( s->fTelemetry )
+            {
+                abctime clk = Abc_Clock();
+                proof_id = solver2_analyze(s, confl, &learnt_clause);
+                s->timeAnalyze += Abc_Clock() - clk;
+            }
+            else
+                proof_id = solver2_analyze(s, confl, &learnt_clause);
             blevel = veci_size(&learnt_clause) > 1 ? var_level(s, lit_var(veci_begin(&learnt_clause)[1])) : s->root_level;
             blevel = s->root_level > blevel ? s->root_level : blevel;
             solver2_canceluntil(s,blevel);
@@ -1163,6 +1170,8 @@ sat_solver2* sat_solver2_new(void)
     s->iVarPivot              =  0; // the pivot for variables
     s->iTrailPivot            =  0; // the pivot for trail
     s->hProofPivot            =  1; // the pivot for proof records
+    s->hProofYoung            =  2; // the first proof record not seen by the last reduction
+    s->hProofFull             =  0; // the proof size after the last full reduction
     return s;
 }
 
@@ -1568,12 +1577,24 @@ void sat_solver2_reducedb(sat_solver2* s)
     // compact proof (compacts 'proofs' and update 'claProofs')
     if ( s->pPrf1 )
     {
-        extern int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot );
-        s->hProofPivot = Sat_ProofReduce( s->pPrf1, &s->claProofs, s->hProofPivot );
+        extern int Sat_ProofReduceYoung( Vec_Set_t * vProof, void * pRoots, int hProofPivot, int hYoung );
+        // only the records added since the last reduction are compacted, unless
+        // the older records have grown by half since the last full reduction
+        int hYoung = Abc_MinInt( s->hProofYoung, Vec_SetHandCurrent(s->pPrf1) );
+        if ( hYoung > s->hProofFull + s->hProofFull / 2 )
+            hYoung = 2;
+        s->hProofPivot = Sat_ProofReduceYoung( s->pPrf1, &s->claProofs, s->hProofPivot, hYoung );
+        s->hProofYoung = Vec_SetHandCurrent(s->pPrf1);
+        if ( hYoung == 2 )
+        {
+            s->hProofFull = s->hProofYoung;
+            Vec_SetFreeUnused( s->pPrf1 );
+        }
     }
 
     // report the results
     TimeTotal += Abc_Clock() - clk;
+    s->timeReduce += Abc_Clock() - clk;
     if ( s->fVerbose )
     {
         Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
@@ -1637,6 +1658,7 @@ void sat_solver2_rollback( sat_solver2* s )
     {
         veci_resize(&s->claProofs, s->stats.learnts);
         Vec_SetShrink(s->pPrf1, s->hProofPivot); 
+        s->hProofYoung = Abc_MaxInt( 2, Abc_MinInt(s->hProofYoung, s->hProofPivot) );
         // some weird bug here, which shows only on 64-bits!
         // temporarily, perform more general proof reduction
 //        Sat_ProofReduce( s->pPrf1, &s->claProofs, s->hProofPivot );
@@ -1677,6 +1699,9 @@ void sat_solver2_rollback( sat_solver2* s )
         s->stats.learnts          = 0;
         s->stats.learnts_literals = 0;
         s->stats.tot_literals     = 0;
+        s->timeSearch             = 0;
+        s->timeAnalyze            = 0;
+        s->timeReduce             = 0;
         // initialize clause pointers
         s->hLearntLast            = -1; // the last learnt clause 
         s->hProofLast             = -1; // the last proof ID
@@ -1685,6 +1710,8 @@ void sat_solver2_rollback( sat_solver2* s )
         s->iVarPivot              =  0; // the pivot for variables
         s->iTrailPivot            =  0; // the pivot for trail
         s->hProofPivot            =  1; // the pivot for proof records
+        s->hProofYoung            =  2; // the first proof record not seen by the last reduction
+        s->hProofFull             =  0; // the proof size after the last full reduction
     }
 }
 
@@ -1965,7 +1992,14 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             sat_solver2_reducedb(s);
         // perform next run
         nof_conflicts = (ABC_INT64_T)( 100 * luby2(2, restart_iter++) );
-        status = solver2_search(s, nof_conflicts);
+        if ( s->fTelemetry )
+        {
+            abctime clk = Abc_Clock();
+            status = solver2_search(s, nof_conflicts);
+            s->timeSearch += Abc_Clock() - clk;
+        }
+        else
+            status = solver2_search(s, nof_conflicts);
         // quit the loop if reached an external limit
         if ( s->nConfLimit && s->stats.conflicts > s->nConfLimit )
             break;
@@ -59,6 +59,7 @@ extern void         sat_solver2_setnvars(sat_solver2* s,int n);
 
 extern void         Sat_Solver2WriteDimacs( sat_solver2 * p, char * pFileName, lit* assumptionsBegin, lit* assumptionsEnd, int incrementVars );
 extern void         Sat_Solver2PrintStats( FILE * pFile, sat_solver2 * p );
+extern void         Sat_Solver2TeleCollect( sat_solver2 * p, Sat_Tele_t * pTele );
 extern int *        Sat_Solver2GetModel( sat_solver2 * p, int * pVars, int nVars );
 extern void         Sat_Solver2DoubleClauses( sat_solver2 * p, int iVar );
 
@@ -124,6 +125,10 @@ struct sat_solver2_t
     int             fSkipSimplify;  // set to one to skip simplification of the clause database
     int             fProofLogging;  // enable proof-logging
     int             fVerbose;
+    int             fTelemetry;     // measure the runtime of solver phases
+    abctime         timeSearch;     // runtime of the search (if fTelemetry is set)
+    abctime         timeAnalyze;    // runtime of conflict analysis (if fTelemetry is set)
+    abctime         timeReduce;     // runtime of learned clause reduction (if fTelemetry is set)
 
     // clauses
     Sat_Mem_t       Mem;
@@ -135,6 +140,8 @@ struct sat_solver2_t
     int             iVarPivot;      // the pivot for variables
     int             iTrailPivot;    // the pivot for trail
     int             hProofPivot;    // the pivot for proof records
+    int             hProofYoung;    // the first proof record not seen by the last reduction
+    int             hProofFull;     // the proof size after the last full reduction
 
     // internal state
     varinfo2 *      vi;             // variable information
@@ -226,6 +226,192 @@ void Sat_Solver2PrintStats( FILE * pFile, sat_solver2 * s )
 */
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds statistics of the clause arena to the telemetry.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Sat_TeleAddWatch( Sat_Tele_t * p, int Size )
+{
+    p->WatchHist[Size ? Abc_MinInt( Abc_Base2Log(Size + 1), SAT_TELE_WATCH - 1 ) : 0]++;
+}
+static void Sat_TeleCollectMem( Sat_Tele_t * p, Sat_Mem_t * pMem )
+{
+    clause * c;
+    int i, k, Bucket;
+    p->MemClauses += Sat_MemMemoryUsed( pMem, 0 );
+    p->MemLearnts += Sat_MemMemoryUsed( pMem, 1 );
+    p->MemAll     += Sat_MemMemoryAll( pMem );
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        Bucket = Abc_MinInt( c->lbd, SAT_TELE_LBD - 1 );
+        p->LbdCount[Bucket]++;
+        p->LbdBytes[Bucket] += 4.0 * Sat_MemClauseSize(c);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the solver statistics to the telemetry.]
+
+  Description [Can be called for several solvers (for example, before 
+  each of them is deleted) to accumulate the statistics of an engine.
+  The runtime of search and conflict analysis is only measured if the
+  solver was created with fTelemetry set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_SolverTeleCollect( sat_solver * s, Sat_Tele_t * p )
+{
+    int i, k, nWatch;
+    p->nSolvers++;
+    p->nVars         += s->size;
+    p->nClauses      += s->stats.clauses;
+    p->nLearnts      += s->stats.learnts;
+    p->nStarts       += s->stats.starts;
+    p->nDecisions    += s->stats.decisions;
+    p->nPropagations += s->stats.propagations;
+    p->nInspects     += s->stats.inspects;
+    p->nConflicts    += s->stats.conflicts;
+    p->nReduces      += s->nDBreduces;
+    p->timeSearch    += s->timeSearch;
+    p->timeAnalyze   += s->timeAnalyze;
+    p->timeReduce    += s->timeReduce;
+    Sat_TeleCollectMem( p, &s->Mem );
+    // a watcher of a long clause takes two entries (the clause and the blocker)
+    for ( i = 0; i < 2 * s->size; i++ )
+    {
+        int * pArray = veci_begin( s->wlists + i );
+        for ( nWatch = k = 0; k < veci_size(s->wlists + i); k += sat_solver_watch_size(pArray[k]) )
+            nWatch++;
+        Sat_TeleAddWatch( p, nWatch );
+    }
+}
+void Sat_Solver2TeleCollect( sat_solver2 * s, Sat_Tele_t * p )
+{
+    int i;
+    p->nSolvers++;
+    p->nVars         += s->size;
+    p->nClauses      += s->stats.clauses;
+    p->nLearnts      += s->stats.learnts;
+    p->nStarts       += s->stats.starts;
+    p->nDecisions    += s->stats.decisions;
+    p->nPropagations += s->stats.propagations;
+    p->nInspects     += s->stats.inspects;
+    p->nConflicts    += s->stats.conflicts;
+    p->nReduces      += s->nDBreduces;
+    p->timeSearch    += s->timeSearch;
+    p->timeAnalyze   += s->timeAnalyze;
+    p->timeReduce    += s->timeReduce;
+    Sat_TeleCollectMem( p, &s->Mem );
+    for ( i = 0; i < 2 * s->size; i++ )
+        Sat_TeleAddWatch( p, veci_size(s->wlists + i) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the telemetry.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_TelePrint( FILE * pFile, Sat_Tele_t * p )
+{
+    double Time = 1.0 * p->timeSearch / CLOCKS_PER_SEC;
+    int i;
+    fprintf( pFile, "Solvers = %d.  Vars = %.0f.  Clauses = %.0f.  Learned = %.0f.  Restarts = %.0f.  Reductions = %.0f.\n",
+        p->nSolvers, (double)p->nVars, (double)p->nClauses, (double)p->nLearnts, (double)p->nStarts, (double)p->nReduces );
+    fprintf( pFile, "Conflicts = %.0f.  Decisions = %.0f.  Propagations = %.0f.  Inspects = %.0f.\n",
+        (double)p->nConflicts, (double)p->nDecisions, (double)p->nPropagations, (double)p->nInspects );
+    fprintf( pFile, "Search = %.2f sec.  Analysis = %.2f sec.  ReduceDB = %.2f sec.  Propagations/sec = %.0f.\n",
+        Time, 1.0 * p->timeAnalyze / CLOCKS_PER_SEC, 1.0 * p->timeReduce / CLOCKS_PER_SEC, Time > 0 ? p->nPropagations / Time : 0.0 );
+    fprintf( pFile, "Memory: problem = %.2f MB.  learned = %.2f MB.  allocated = %.2f MB.\n",
+        p->MemClauses / (1<<20), p->MemLearnts / (1<<20), p->MemAll / (1<<20) );
+    fprintf( pFile, "Watch list length :" );
+    for ( i = 0; i < SAT_TELE_WATCH; i++ )
+        if ( p->WatchHist[i] )
+            fprintf( pFile, "  %d-%d=%.0f", i ? 1 << (i-1) : 0, i ? (1 << i) - 1 : 0, (double)p->WatchHist[i] );
+    fprintf( pFile, "\n" );
+    fprintf( pFile, "Learned by LBD    :" );
+    for ( i = 0; i < SAT_TELE_LBD; i++ )
+        if ( p->LbdCount[i] )
+            fprintf( pFile, "  %d%s=%.0f (%.2f MB)", i, i == SAT_TELE_LBD - 1 ? "+" : "", (double)p->LbdCount[i], p->LbdBytes[i] / (1<<20) );
+    fprintf( pFile, "\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the telemetry into a file in JSON format.]
+
+  Description [Bucket i of the watch list histogram counts the literals 
+  whose watch list length is in [2^(i-1), 2^i-1]; bucket 0 counts empty
+  lists. The last LBD bucket includes the larger LBDs. Returns 1 if the 
+  file was written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_TeleDumpJson( Sat_Tele_t * p, char * pFileName, char * pEngine )
+{
+    double Time = 1.0 * p->timeSearch / CLOCKS_PER_SEC;
+    FILE * pFile = fopen( pFileName, "wb" );
+    int i;
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the SAT solver telemetry.\n", pFileName );
+        return 0;
+    }
+    fprintf( pFile, "{\n" );
+    fprintf( pFile, "  \"engine\": \"%s\",\n", pEngine ? pEngine : "" );
+    fprintf( pFile, "  \"solvers\": %d,\n", p->nSolvers );
+    fprintf( pFile, "  \"vars\": %.0f,\n", (double)p->nVars );
+    fprintf( pFile, "  \"clauses\": %.0f,\n", (double)p->nClauses );
+    fprintf( pFile, "  \"learnts\": %.0f,\n", (double)p->nLearnts );
+    fprintf( pFile, "  \"restarts\": %.0f,\n", (double)p->nStarts );
+    fprintf( pFile, "  \"decisions\": %.0f,\n", (double)p->nDecisions );
+    fprintf( pFile, "  \"propagations\": %.0f,\n", (double)p->nPropagations );
+    fprintf( pFile, "  \"inspects\": %.0f,\n", (double)p->nInspects );
+    fprintf( pFile, "  \"conflicts\": %.0f,\n", (double)p->nConflicts );
+    fprintf( pFile, "  \"reductions\": %.0f,\n", (double)p->nReduces );
+    fprintf( pFile, "  \"time_search\": %.6f,\n", Time );
+    fprintf( pFile, "  \"time_analyze\": %.6f,\n", 1.0 * p->timeAnalyze / CLOCKS_PER_SEC );
+    fprintf( pFile, "  \"time_reduce\": %.6f,\n", 1.0 * p->timeReduce / CLOCKS_PER_SEC );
+    fprintf( pFile, "  \"propagations_per_sec\": %.0f,\n", Time > 0 ? p->nPropagations / Time : 0.0 );
+    fprintf( pFile, "  \"mem_problem_bytes\": %.0f,\n", p->MemClauses );
+    fprintf( pFile, "  \"mem_learned_bytes\": %.0f,\n", p->MemLearnts );
+    fprintf( pFile, "  \"mem_allocated_bytes\": %.0f,\n", p->MemAll );
+    fprintf( pFile, "  \"watch_hist\": [" );
+    for ( i = 0; i < SAT_TELE_WATCH; i++ )
+        fprintf( pFile, "%s%.0f", i ? ", " : "", (double)p->WatchHist[i] );
+    fprintf( pFile, "],\n" );
+    fprintf( pFile, "  \"lbd_count\": [" );
+    for ( i = 0; i < SAT_TELE_LBD; i++ )
+        fprintf( pFile, "%s%.0f", i ? ", " : "", (double)p->LbdCount[i] );
+    fprintf( pFile, "],\n" );
+    fprintf( pFile, "  \"lbd_bytes\": [" );
+    for ( i = 0; i < SAT_TELE_LBD; i++ )
+        fprintf( pFile, "%s%.0f", i ? ", " : "", p->LbdBytes[i] );
+    fprintf( pFile, "]\n" );
+    fprintf( pFile, "}\n" );
+    fclose( pFile );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the number of bytes used for each variable.]
@@ -344,6 +530,101 @@ void Sat_SolverDoubleClauses( sat_solver * p, int iVar )
 */
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks the watch lists of the variables below the pivot.]
+
+  Description [Returns 1 if every watcher refers to a clause that survived 
+  the rollback, every binary watcher has its pair in the watch list of 
+  the other literal, and every long clause watcher is followed by 
+  a blocker taken from this clause.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sat_SolverCheckWatches( sat_solver * p )
+{
+    Sat_Mem_t * pMem = &p->Mem;
+    clause * c;
+    int i, k, m;
+    for ( i = 0; i < 2 * p->iVarPivot; i++ )
+    {
+        veci * vWatch = &p->wlists[i];
+        cla * pArray = veci_begin( vWatch );
+        for ( k = 0; k < veci_size(vWatch); k += sat_solver_watch_size(pArray[k]) )
+        {
+            if ( !Sat_MemClauseUsed(pMem, pArray[k]) )
+                return 0;
+            if ( clause_is_lit(pArray[k]) )
+            {
+                veci * vPair = &p->wlists[lit_neg(clause_read_lit(pArray[k]))];
+                for ( m = 0; m < veci_size(vPair); m += sat_solver_watch_size(veci_begin(vPair)[m]) )
+                    if ( veci_begin(vPair)[m] == clause_from_lit(lit_neg(i)) )
+                        break;
+                if ( m == veci_size(vPair) )
+                    return 0;
+                continue;
+            }
+            if ( k + 1 == veci_size(vWatch) )
+                return 0;
+            c = clause_read( p, pArray[k] );
+            for ( m = 0; m < clause_size(c); m++ )
+                if ( clause_begin(c)[m] == pArray[k+1] )
+                    break;
+            if ( m == clause_size(c) )
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tests the rollback of watch lists with mixed watchers.]
+
+  Description [Adds a long clause before the bookmark and a binary clause 
+  after it. Solving under an assumption moves a watcher of the long clause 
+  behind the binary watcher, so that the rollback has to remove a one-entry 
+  watcher followed by a two-entry watcher in the same list. Returns 1 if 
+  the watch lists are correct after the rollback.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_SolverRollbackTest()
+{
+    sat_solver * p = sat_solver_new();
+    lit Lits[3], Assump;
+    int RetValue;
+    sat_solver_setnvars( p, 10 );
+    // long clause (x1 + !x4 + !x7) watched by x1 and !x4
+    Lits[0] = toLitCond( 1, 0 );
+    Lits[1] = toLitCond( 4, 1 );
+    Lits[2] = toLitCond( 7, 1 );
+    sat_solver_addclause( p, Lits, Lits + 3 );
+    sat_solver_bookmark( p );
+    // binary clause (!x7 + x5) removed by the rollback
+    Lits[0] = toLitCond( 7, 1 );
+    Lits[1] = toLitCond( 5, 0 );
+    sat_solver_addclause( p, Lits, Lits + 2 );
+    // assigning x1 to 0 moves the watcher of the long clause to !x7 behind the binary clause
+    Assump = toLitCond( 1, 1 );
+    RetValue = sat_solver_solve( p, &Assump, &Assump + 1, 0, 0, 0, 0 );
+    assert( RetValue == l_True );
+    sat_solver_rollback( p );
+    RetValue = Sat_SolverCheckWatches( p );
+    // the solver should still be usable
+    if ( RetValue && sat_solver_solve( p, &Assump, &Assump + 1, 0, 0, 0, 0 ) != l_True )
+        RetValue = 0;
+    sat_solver_delete( p );
+    printf( "Rollback of watch lists with mixed watchers %s.\n", RetValue ? "passed" : "FAILED" );
+    return RetValue;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -156,6 +156,34 @@ struct stats_t
 };
 typedef struct stats_t stats_t;
 
+// solver telemetry accumulated over one or more solvers
+#define SAT_TELE_WATCH  16  // watch list length buckets: 0, 1, 2-3, 4-7, ..., 2^14 and more
+#define SAT_TELE_LBD     8  // learned clause LBD buckets: 0, 1, ..., 6, 7 and more
+
+typedef struct Sat_Tele_t_ Sat_Tele_t;
+struct Sat_Tele_t_
+{
+    int         nSolvers;                  // the number of solvers collected
+    ABC_INT64_T nVars;                     // variables
+    ABC_INT64_T nClauses;                  // problem clauses
+    ABC_INT64_T nLearnts;                  // learned clauses currently in the database
+    ABC_INT64_T nStarts;                   // restarts
+    ABC_INT64_T nDecisions;                // decisions
+    ABC_INT64_T nPropagations;             // propagations
+    ABC_INT64_T nInspects;                 // inspected clauses
+    ABC_INT64_T nConflicts;                // conflicts
+    ABC_INT64_T nReduces;                  // learned clause database reductions
+    abctime     timeSearch;                // runtime of the search
+    abctime     timeAnalyze;               // runtime of conflict analysis
+    abctime     timeReduce;                // runtime of learned clause reduction
+    double      MemClauses;                // clause arena bytes used by problem clauses
+    double      MemLearnts;                // clause arena bytes used by learned clauses
+    double      MemAll;                    // clause arena bytes allocated
+    ABC_INT64_T WatchHist[SAT_TELE_WATCH]; // watch lists by length (log2 buckets)
+    ABC_INT64_T LbdCount[SAT_TELE_LBD];    // learned clauses by LBD
+    double      LbdBytes[SAT_TELE_LBD];    // clause arena bytes of learned clauses by LBD
+};
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
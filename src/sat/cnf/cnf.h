@@ -34,6 +34,8 @@
 #include "misc/vec/vec.h"
 #include "aig/aig/aig.h"
 #include "opt/dar/darInt.h"
+#include "aig/gia/gia.h"
+#include "sat/bsat/satSolver.h"
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -50,6 +52,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
+typedef struct Cnf_Inc_t_            Cnf_Inc_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
 
 // the CNF asserting outputs of AIG to be 1
@@ -93,6 +96,21 @@ struct Cnf_Man_t_
     abctime         timeSave;
 };
 
+// the parameters of CNF simplification
+typedef struct Cnf_SimpPars_t_       Cnf_SimpPars_t;
+struct Cnf_SimpPars_t_
+{
+    int             nResolveMax;     // the largest resolvent allowed during elimination
+    int             nOccurMax;       // the largest number of occurrences of an eliminated variable
+    int             nSubsumeMax;     // the limit on the number of subsumption checks
+    int             nProbeProps;     // the limit on the number of clause visits during probing
+    int             nRounds;         // the number of elimination rounds
+    int             fElim;           // performs bounded variable elimination
+    int             fSubsume;        // performs subsumption and strengthening
+    int             fProbe;          // performs failed-literal probing
+    int             fVerbose;        // verbose output
+};
+
 
 static inline Dar_Cut_t *  Dar_ObjBestCut( Aig_Obj_t * pObj ) { Dar_Cut_t * pCut; int i; Dar_ObjForEachCut( pObj, pCut, i ) if ( pCut->fBest ) return pCut; return NULL; }
 
@@ -148,6 +166,19 @@ extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+/*=== cnfInc.c ========================================================*/
+extern Cnf_Inc_t *     Cnf_IncStart( Gia_Man_t * pGia, Cnf_Dat_t * pCnf, sat_solver * pSat, int nVarsMax );
+extern void            Cnf_IncStop( Cnf_Inc_t * p );
+extern sat_solver *    Cnf_IncSolver( Cnf_Inc_t * p );
+extern int             Cnf_IncVarNum( Cnf_Inc_t * p );
+extern int             Cnf_IncObjVar( Cnf_Inc_t * p, int iObj );
+extern int             Cnf_IncLoadLit( Cnf_Inc_t * p, int iLit );
+extern int             Cnf_IncLoadCo( Cnf_Inc_t * p, int iCo );
+extern int             Cnf_IncRecycle( Cnf_Inc_t * p );
+extern void            Cnf_IncPrintStats( Cnf_Inc_t * p );
+/*=== cnfLut.c ========================================================*/
+extern Vec_Int_t *     Cnf_DeriveLutMapping( Aig_Man_t * pAig, int nLutSize, Vec_Wrd_t ** pvTruths );
+extern Cnf_Dat_t *     Cnf_DeriveLut( Aig_Man_t * pAig, int nLutSize );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
@@ -172,6 +203,10 @@ extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
 extern void            Cnf_ManFreeCuts( Cnf_Man_t * p );
 extern void            Cnf_ManPostprocess( Cnf_Man_t * p );
+/*=== cnfSimp.c ========================================================*/
+extern void            Cnf_SimpSetDefaultParams( Cnf_SimpPars_t * pPars );
+extern int             Cnf_DataSimplify( Cnf_Dat_t * p, Vec_Int_t * vFrozen, Cnf_SimpPars_t * pPars );
+extern Vec_Int_t *     Cnf_DataCollectFrozen( Cnf_Dat_t * pCnf, Aig_Man_t * p );
 /*=== cnfUtil.c ========================================================*/
 extern Vec_Ptr_t *     Aig_ManScanMapping( Cnf_Man_t * p, int fCollect );
 extern Vec_Ptr_t *     Cnf_ManScanMapping( Cnf_Man_t * p, int fCollect, int fPreorder );
@@ -0,0 +1,459 @@
+/**CFile****************************************************************
+
+  FileName    [cnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Incremental CNF loading for GIA managers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfInc.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The encoder loads the transitive fanin of the requested literals into
+// the SAT solver on demand. Each object is encoded at most once. If LUT-based CNF of the same GIA is given (for example,
+// derived by Jf_ManDeriveCnf() or Cnf_DeriveOther()), the clauses of the
+// mapped nodes are used; otherwise, the nodes are encoded using Tseitin
+// transformation with MUX and multi-input AND detection, where the
+// multi-input ANDs do not extend beyond the nodes with multiple fanouts.
+// When the number of variables exceeds the limit, Cnf_IncRecycle() restarts
+// the solver, and the cones are reloaded by the following calls.
+
+struct Cnf_Inc_t_
+{
+    Gia_Man_t *         pGia;        // the AIG manager (not owned)
+    Cnf_Dat_t *         pCnf;        // LUT-based CNF of the manager (not owned)
+    sat_solver *        pSat;        // the SAT solver
+    int                 fOwnSat;     // the solver was created by the encoder
+    int                 nVars;       // the counter of SAT variables
+    int                 nVarsMax;    // the recycling limit (0 = no limit)
+    int                 nObjsRef;    // the number of objects counted in vRefs
+    Vec_Int_t *         vId2Var;     // maps GIA IDs into SAT vars (-1 if not loaded)
+    Vec_Int_t *         vRefs;       // the fanout counters (used without LUT-based CNF)
+    Vec_Int_t *         vFront;      // the nodes waiting for their clauses
+    Vec_Int_t *         vStack;      // the stack for collecting supergates
+    Vec_Int_t *         vFanins;     // the fanins of a node
+    Vec_Int_t *         vLits;       // temporary clause
+    // statistics
+    int                 nNodesTsei;  // nodes encoded with Tseitin clauses
+    int                 nNodesLut;   // nodes encoded with LUT clauses
+    int                 nClauses;    // clauses added
+    int                 nRecycles;   // solver recycling
+    abctime             timeCnf;     // CNF generation time
+};
+
+static inline int  Cnf_IncObjVar_( Cnf_Inc_t * p, int iObj )  { return Vec_IntEntry(p->vId2Var, iObj);                                       }
+static inline int  Cnf_IncObjLit_( Cnf_Inc_t * p, int iLit )  { return Abc_Var2Lit(Cnf_IncObjVar_(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit)); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental encoder.]
+
+  Description [If pCnf is not NULL, it should be LUT-based CNF derived
+  for pGia, with clause literals expressed using object IDs of pGia.
+  If pSat is not NULL, the encoder adds new variables after those already
+  present in this solver, and the solver is not deleted by the encoder.
+  If nVarsMax is not 0, it is the number of variables, after which
+  Cnf_IncRecycle() restarts the solver.
+  The AIG may grow between the calls, as long as the existing objects
+  do not change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Inc_t * Cnf_IncStart( Gia_Man_t * pGia, Cnf_Dat_t * pCnf, sat_solver * pSat, int nVarsMax )
+{
+    Cnf_Inc_t * p;
+    p = ABC_CALLOC( Cnf_Inc_t, 1 );
+    p->pGia     = pGia;
+    p->pCnf     = pCnf;
+    p->fOwnSat  = (pSat == NULL);
+    p->pSat     = pSat ? pSat : sat_solver_new();
+    p->nVars    = sat_solver_nvars( p->pSat );
+    p->nVarsMax = nVarsMax;
+    p->vId2Var  = Vec_IntStartFull( Gia_ManObjNum(p->pGia) );
+    p->vRefs    = Vec_IntAlloc( pCnf ? 0 : Gia_ManObjNum(p->pGia) );
+    p->vFront   = Vec_IntAlloc( 1000 );
+    p->vStack   = Vec_IntAlloc( 100 );
+    p->vFanins  = Vec_IntAlloc( 100 );
+    p->vLits    = Vec_IntAlloc( 100 );
+    sat_solver_setnvars( p->pSat, p->nVars + 1000 );
+    return p;
+}
+void Cnf_IncStop( Cnf_Inc_t * p )
+{
+    if ( p->fOwnSat )
+        sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vId2Var );
+    Vec_IntFree( p->vRefs );
+    Vec_IntFree( p->vFront );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vFanins );
+    Vec_IntFree( p->vLits );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Access procedures.]
+
+  Description [Cnf_IncObjVar() returns -1 if the object is not loaded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+sat_solver * Cnf_IncSolver( Cnf_Inc_t * p )
+{
+    return p->pSat;
+}
+int Cnf_IncVarNum( Cnf_Inc_t * p )
+{
+    return p->nVars;
+}
+int Cnf_IncObjVar( Cnf_Inc_t * p, int iObj )
+{
+    return iObj < Vec_IntSize(p->vId2Var) ? Vec_IntEntry(p->vId2Var, iObj) : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses to the solver.]
+
+  Description [The clauses define a new variable in terms of the loaded
+  ones, so they cannot conflict unless the solver is already UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_IncAddClause( Cnf_Inc_t * p, int * pBeg, int * pEnd )
+{
+    int RetValue = sat_solver_addclause( p->pSat, pBeg, pEnd );
+    assert( RetValue );
+    p->nClauses++;
+}
+static void Cnf_IncAddClausesMux( Cnf_Inc_t * p, Gia_Obj_t * pNode )
+{
+    Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
+    int pLits[3], LitF, LitI, LitT, LitE;
+    assert( !Gia_IsComplement( pNode ) );
+    assert( Gia_ObjIsMuxType( pNode ) );
+    // get nodes (I = if, T = then, E = else)
+    pNodeI = Gia_ObjRecognizeMux( pNode, &pNodeT, &pNodeE );
+    // get the literals
+    LitF = Abc_Var2Lit( Cnf_IncObjVar_(p, Gia_ObjId(p->pGia, pNode)), 0 );
+    LitI = Cnf_IncObjLit_( p, Gia_Obj2Lit(p->pGia, pNodeI) );
+    LitT = Cnf_IncObjLit_( p, Gia_Obj2Lit(p->pGia, pNodeT) );
+    LitE = Cnf_IncObjLit_( p, Gia_Obj2Lit(p->pGia, pNodeE) );
+    // f = ITE(i, t, e)
+    pLits[0] = Abc_LitNot(LitI); pLits[1] = Abc_LitNot(LitT); pLits[2] = LitF;
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+    pLits[0] = Abc_LitNot(LitI); pLits[1] = LitT; pLits[2] = Abc_LitNot(LitF);
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+    pLits[0] = LitI; pLits[1] = Abc_LitNot(LitE); pLits[2] = LitF;
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+    pLits[0] = LitI; pLits[1] = LitE; pLits[2] = Abc_LitNot(LitF);
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+    // two additional clauses
+    if ( LitT == LitE )
+        return;
+    pLits[0] = LitT; pLits[1] = LitE; pLits[2] = Abc_LitNot(LitF);
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+    pLits[0] = Abc_LitNot(LitT); pLits[1] = Abc_LitNot(LitE); pLits[2] = LitF;
+    Cnf_IncAddClause( p, pLits, pLits + 3 );
+}
+static void Cnf_IncAddClausesSuper( Cnf_Inc_t * p, Gia_Obj_t * pNode, Vec_Int_t * vSuper )
+{
+    int i, Lit, LitNode, pLits[2];
+    assert( !Gia_IsComplement(pNode) );
+    assert( Gia_ObjIsAnd(pNode) );
+    LitNode = Abc_Var2Lit( Cnf_IncObjVar_(p, Gia_ObjId(p->pGia, pNode)), 0 );
+    // add !A => !C   or   A + !C
+    Vec_IntClear( p->vLits );
+    Vec_IntForEachEntry( vSuper, Lit, i )
+    {
+        pLits[0] = Cnf_IncObjLit_( p, Lit );
+        pLits[1] = Abc_LitNot( LitNode );
+        Cnf_IncAddClause( p, pLits, pLits + 2 );
+        Vec_IntPush( p->vLits, Abc_LitNot(pLits[0]) );
+    }
+    // add A & B => C   or   !A + !B + C
+    Vec_IntPush( p->vLits, LitNode );
+    Cnf_IncAddClause( p, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) );
+}
+static void Cnf_IncAddClausesLut( Cnf_Inc_t * p, int iObj )
+{
+    int i, k, nClas = p->pCnf->pObj2Count[iObj];
+    int iCla = p->pCnf->pObj2Clause[iObj];
+    for ( i = 0; i < nClas; i++ )
+    {
+        int * pClauseThis = p->pCnf->pClauses[iCla+i];
+        int * pClauseNext = p->pCnf->pClauses[iCla+i+1];
+        Vec_IntClear( p->vLits );
+        for ( k = 0; pClauseThis + k < pClauseNext; k++ )
+        {
+            assert( pClauseThis[k] > 1 && pClauseThis[k] < 2*Gia_ManObjNum(p->pGia) );
+            Vec_IntPush( p->vLits, Cnf_IncObjLit_(p, pClauseThis[k]) );
+        }
+        Cnf_IncAddClause( p, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the supergate.]
+
+  Description [The supergate stops at complemented edges, non-AND nodes,
+  MUXes, and nodes with more than one fanout. The interior nodes have one
+  fanout and are visited once, so only the repeated leaves are checked
+  for duplicates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_IncUpdateRefs( Cnf_Inc_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Vec_IntFillExtra( p->vRefs, Gia_ManObjNum(p->pGia), 0 );
+    for ( i = p->nObjsRef; i < Gia_ManObjNum(p->pGia); i++ )
+    {
+        pObj = Gia_ManObj( p->pGia, i );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0(pObj, i), 1 );
+            Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId1(pObj, i), 1 );
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+            Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0(pObj, i), 1 );
+    }
+    p->nObjsRef = Gia_ManObjNum(p->pGia);
+}
+static void Cnf_IncCollectSuper( Cnf_Inc_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vSuper )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    int iLit, iObj;
+    assert( !Gia_IsComplement(pRoot) );
+    assert( Gia_ObjIsAnd(pRoot) );
+    Vec_IntClear( vSuper );
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, Gia_ObjFaninLit1p(pGia, pRoot) );
+    Vec_IntPush( p->vStack, Gia_ObjFaninLit0p(pGia, pRoot) );
+    Gia_ManIncrementTravId( pGia );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iLit = Vec_IntPop( p->vStack );
+        iObj = Abc_Lit2Var( iLit );
+        pObj = Gia_ManObj( pGia, iObj );
+        if ( !Abc_LitIsCompl(iLit) && Gia_ObjIsAnd(pObj) && Vec_IntEntry(p->vRefs, iObj) == 1 && !Gia_ObjIsMuxType(pObj) )
+        {
+            Vec_IntPush( p->vStack, Gia_ObjFaninLit1(pObj, iObj) );
+            Vec_IntPush( p->vStack, Gia_ObjFaninLit0(pObj, iObj) );
+        }
+        else if ( Gia_ObjIsTravIdCurrentId(pGia, iObj) )
+            Vec_IntPushUnique( vSuper, iLit );
+        else
+        {
+            Gia_ObjSetTravIdCurrentId( pGia, iObj );
+            Vec_IntPush( vSuper, iLit );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cone of the object into the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_IncAddToFrontier( Cnf_Inc_t * p, int iObj )
+{
+    if ( Cnf_IncObjVar_(p, iObj) >= 0 )
+        return;
+    Vec_IntWriteEntry( p->vId2Var, iObj, p->nVars++ );
+    if ( iObj == 0 ) // constant
+    {
+        int Lit = Abc_Var2Lit( p->nVars - 1, 1 );
+        sat_solver_setnvars( p->pSat, p->nVars );
+        Cnf_IncAddClause( p, &Lit, &Lit + 1 );
+    }
+    else if ( Gia_ObjIsAnd(Gia_ManObj(p->pGia, iObj)) )
+        Vec_IntPush( p->vFront, iObj );
+    else assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+}
+static void Cnf_IncLoadObj( Cnf_Inc_t * p, int iObj )
+{
+    Gia_Obj_t * pNode;
+    int i, k, Id, Lit;
+    abctime clk;
+    if ( Cnf_IncObjVar_(p, iObj) >= 0 )
+        return;
+clk = Abc_Clock();
+    Vec_IntClear( p->vFront );
+    Cnf_IncAddToFrontier( p, iObj );
+    Vec_IntForEachEntry( p->vFront, iObj, i )
+    {
+        pNode = Gia_ManObj( p->pGia, iObj );
+        if ( p->pCnf && p->pCnf->pObj2Count[iObj] > 0 )
+        {
+            // the fanins of the LUT are the variables of its clauses
+            int iBeg = p->pCnf->pObj2Clause[iObj];
+            int iEnd = iBeg + p->pCnf->pObj2Count[iObj];
+            int * pLit, * pStop = p->pCnf->pClauses[iEnd];
+            for ( pLit = p->pCnf->pClauses[iBeg]; pLit < pStop; pLit++ )
+                Cnf_IncAddToFrontier( p, Abc_Lit2Var(*pLit) );
+            sat_solver_setnvars( p->pSat, p->nVars );
+            Cnf_IncAddClausesLut( p, iObj );
+            p->nNodesLut++;
+        }
+        else if ( p->pCnf )
+        {
+            // the node is not mapped, use the AND-gate
+            Vec_IntClear( p->vFanins );
+            Vec_IntPush( p->vFanins, Gia_ObjFaninLit0(pNode, iObj) );
+            Vec_IntPush( p->vFanins, Gia_ObjFaninLit1(pNode, iObj) );
+            Vec_IntForEachEntry( p->vFanins, Lit, k )
+                Cnf_IncAddToFrontier( p, Abc_Lit2Var(Lit) );
+            sat_solver_setnvars( p->pSat, p->nVars );
+            Cnf_IncAddClausesSuper( p, pNode, p->vFanins );
+            p->nNodesTsei++;
+        }
+        else if ( Gia_ObjIsMuxType(pNode) )
+        {
+            Vec_IntClear( p->vFanins );
+            Vec_IntPushUnique( p->vFanins, Gia_ObjFaninId0p( p->pGia, Gia_ObjFanin0(pNode) ) );
+            Vec_IntPushUnique( p->vFanins, Gia_ObjFaninId0p( p->pGia, Gia_ObjFanin1(pNode) ) );
+            Vec_IntPushUnique( p->vFanins, Gia_ObjFaninId1p( p->pGia, Gia_ObjFanin0(pNode) ) );
+            Vec_IntPushUnique( p->vFanins, Gia_ObjFaninId1p( p->pGia, Gia_ObjFanin1(pNode) ) );
+            Vec_IntForEachEntry( p->vFanins, Id, k )
+                Cnf_IncAddToFrontier( p, Id );
+            sat_solver_setnvars( p->pSat, p->nVars );
+            Cnf_IncAddClausesMux( p, pNode );
+            p->nNodesTsei++;
+        }
+        else
+        {
+            Cnf_IncCollectSuper( p, pNode, p->vFanins );
+            Vec_IntForEachEntry( p->vFanins, Lit, k )
+                Cnf_IncAddToFrontier( p, Abc_Lit2Var(Lit) );
+            sat_solver_setnvars( p->pSat, p->nVars );
+            Cnf_IncAddClausesSuper( p, pNode, p->vFanins );
+            p->nNodesTsei++;
+        }
+    }
+    sat_solver_setnvars( p->pSat, p->nVars );
+p->timeCnf += Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT literal of the AIG literal.]
+
+  Description [Loads the part of the transitive fanin of the literal,
+  which is not yet present in the solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncLoadLit( Cnf_Inc_t * p, int iLit )
+{
+    assert( Abc_Lit2Var(iLit) < Gia_ManObjNum(p->pGia) );
+    if ( Vec_IntSize(p->vId2Var) < Gia_ManObjNum(p->pGia) )
+        Vec_IntFillExtra( p->vId2Var, Gia_ManObjNum(p->pGia), -1 );
+    if ( p->pCnf == NULL && p->nObjsRef < Gia_ManObjNum(p->pGia) )
+        Cnf_IncUpdateRefs( p );
+    Cnf_IncLoadObj( p, Abc_Lit2Var(iLit) );
+    return Cnf_IncObjLit_( p, iLit );
+}
+int Cnf_IncLoadCo( Cnf_Inc_t * p, int iCo )
+{
+    Gia_Obj_t * pObj = Gia_ManCo( p->pGia, iCo );
+    return Cnf_IncLoadLit( p, Gia_ObjFaninLit0p(p->pGia, pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restarts the solver if it has too many variables.]
+
+  Description [Returns 1 if the solver was restarted. In this case, all
+  variables and clauses (including those added by the user) are removed
+  and the cones are reloaded on demand by the following calls.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncRecycle( Cnf_Inc_t * p )
+{
+    if ( p->nVarsMax == 0 || p->nVars <= p->nVarsMax )
+        return 0;
+    sat_solver_restart( p->pSat );
+    Vec_IntFill( p->vId2Var, Gia_ManObjNum(p->pGia), -1 );
+    p->nVars = 0;
+    p->nRecycles++;
+    sat_solver_setnvars( p->pSat, 1000 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the encoder.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_IncPrintStats( Cnf_Inc_t * p )
+{
+    printf( "CNF encoder:  Var =%9d.  Cla =%9d.  Tseitin =%9d.  LUT =%9d.  Recycle =%4d.  ",
+        p->nVars, p->nClauses, p->nNodesTsei, p->nNodesLut, p->nRecycles );
+    Abc_PrintTime( 1, "Time", p->timeCnf );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,259 @@
+/**CFile****************************************************************
+
+  FileName    [cnfLut.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [CNF derived from LUT mapping with ISOP clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfLut.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "aig/gia/giaAig.h"
+#include "bool/kit/kit.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the LUT.]
+
+  Description [Assumes that the leaves are labeled with the current
+  traversal ID and have their elementary truth tables in vTemp.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Cnf_LutTruth_rec( Gia_Man_t * p, int iObj, Vec_Wrd_t * vTemp )
+{
+    Gia_Obj_t * pObj;
+    word uTruth0, uTruth1;
+    if ( iObj == 0 )
+        return 0;
+    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return Vec_WrdEntry( vTemp, iObj );
+    Gia_ObjSetTravIdCurrentId( p, iObj );
+    pObj = Gia_ManObj( p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    uTruth0 = Cnf_LutTruth_rec( p, Gia_ObjFaninId0(pObj, iObj), vTemp );
+    uTruth1 = Cnf_LutTruth_rec( p, Gia_ObjFaninId1(pObj, iObj), vTemp );
+    uTruth0 = Gia_ObjFaninC0(pObj) ? ~uTruth0 : uTruth0;
+    uTruth1 = Gia_ObjFaninC1(pObj) ? ~uTruth1 : uTruth1;
+    Vec_WrdWriteEntry( vTemp, iObj, uTruth0 & uTruth1 );
+    return uTruth0 & uTruth1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives LUT mapping of the AIG.]
+
+  Description [Maps the AIG into nLutSize-input LUTs (nLutSize <= 6).
+  Returns the mapping in the format similar to Cnf_DeriveMappingArray():
+  for each object ID, the entry is 0 if the node is not mapped; otherwise
+  it points to nLutSize+1 entries, the first of which is the index of the
+  truth table in *pvTruths, followed by the fanin IDs (-1 if unused).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_DeriveLutMapping( Aig_Man_t * pAig, int nLutSize, Vec_Wrd_t ** pvTruths )
+{
+    Jf_Par_t Pars, * pPars = &Pars;
+    Gia_Man_t * pGia;
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vMapping, * vGia2Aig;
+    Vec_Wrd_t * vTruths, * vTemp;
+    int i, k, iFan, iAig;
+    assert( nLutSize >= 2 && nLutSize <= 6 );
+    // map the AIG
+    pGia = Gia_ManFromAigSimple( pAig );
+    Jf_ManSetDefaultPars( pPars );
+    pPars->nLutSize = nLutSize;
+    Jf_ManPerformMapping( pGia, pPars );
+    assert( Gia_ManHasMapping(pGia) );
+    // map GIA objects back into AIG objects
+    vGia2Aig = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    Aig_ManForEachObj( pAig, pObj, i )
+        if ( !Aig_ObjIsConst1(pObj) )
+            Vec_IntWriteEntry( vGia2Aig, Abc_Lit2Var(pObj->iData), i );
+    // collect the LUTs
+    vTruths  = Vec_WrdAlloc( Gia_ManLutNum(pGia) );
+    vTemp    = Vec_WrdStart( Gia_ManObjNum(pGia) );
+    vMapping = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Gia_ManForEachLut( pGia, i )
+    {
+        iAig = Vec_IntEntry( vGia2Aig, i );
+        assert( iAig > 0 && Aig_ObjIsNode(Aig_ManObj(pAig, iAig)) );
+        Vec_IntWriteEntry( vMapping, iAig, Vec_IntSize(vMapping) );
+        Vec_IntPush( vMapping, Vec_WrdSize(vTruths) );
+        Gia_ManIncrementTravId( pGia );
+        Gia_LutForEachFanin( pGia, i, iFan, k )
+        {
+            Gia_ObjSetTravIdCurrentId( pGia, iFan );
+            Vec_WrdWriteEntry( vTemp, iFan, s_Truths6[k] );
+            Vec_IntPush( vMapping, Vec_IntEntry(vGia2Aig, iFan) );
+        }
+        for ( ; k < nLutSize; k++ )
+            Vec_IntPush( vMapping, -1 );
+        Vec_WrdPush( vTruths, Cnf_LutTruth_rec(pGia, i, vTemp) );
+    }
+    Vec_WrdFree( vTemp );
+    Vec_IntFree( vGia2Aig );
+    Gia_ManStop( pGia );
+    *pvTruths = vTruths;
+    return vMapping;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses of one LUT.]
+
+  Description [The first literal of each clause is the output literal.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_DeriveLutClauses( word uTruth, int iLitOut, int * pFanins, int nFanins, Vec_Int_t * vCover, Vec_Int_t * vLits, Vec_Int_t * vClas )
+{
+    int i, k, c, Cube, Literal, nClauses = 0;
+    if ( uTruth == 0 || ~uTruth == 0 )
+    {
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, Abc_LitNotCond(iLitOut, (uTruth == 0)) );
+        return 1;
+    }
+    for ( c = 0; c < 2; c++, uTruth = ~uTruth )
+    {
+        int RetValue = Kit_TruthIsop( (unsigned *)&uTruth, nFanins, vCover, 0 );
+        assert( RetValue == 0 );
+        Vec_IntForEachEntry( vCover, Cube, i )
+        {
+            Vec_IntPush( vClas, Vec_IntSize(vLits) );
+            Vec_IntPush( vLits, Abc_LitNotCond(iLitOut, c) );
+            for ( k = 0; k < nFanins; k++ )
+            {
+                Literal = 3 & (Cube >> (k << 1));
+                if ( Literal == 1 )      // '0'  -> pos lit
+                    Vec_IntPush( vLits, Abc_Var2Lit(pFanins[k], 0) );
+                else if ( Literal == 2 ) // '1'  -> neg lit
+                    Vec_IntPush( vLits, Abc_Var2Lit(pFanins[k], 1) );
+                else if ( Literal != 0 )
+                    assert( 0 );
+            }
+        }
+        nClauses += Vec_IntSize(vCover);
+    }
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF using LUT mapping.]
+
+  Description [The resulting CNF has the same format as the one returned
+  by Cnf_DeriveOther(): the literals are expressed using object IDs,
+  the first literal of each clause is the output of the node, and the
+  clauses of each node are found using pObj2Clause and pObj2Count.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveLut( Aig_Man_t * pAig, int nLutSize )
+{
+    Cnf_Dat_t * pCnf;
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vMapping, * vCover, * vLits, * vClas;
+    Vec_Wrd_t * vTruths;
+    int i, k, Entry, nFanins, pFanins[6], * pData;
+    vMapping = Cnf_DeriveLutMapping( pAig, nLutSize, &vTruths );
+    vCover = Vec_IntAlloc( 1 << 10 );
+    vLits  = Vec_IntAlloc( 8 * Aig_ManObjNumMax(pAig) );
+    vClas  = Vec_IntAlloc( 2 * Aig_ManObjNumMax(pAig) );
+    // create room for variable numbers
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pMan = pAig;
+    pCnf->nVars = Aig_ManObjNumMax(pAig);
+    pCnf->pObj2Clause = ABC_FALLOC( int, Aig_ManObjNumMax(pAig) );
+    pCnf->pObj2Count  = ABC_FALLOC( int, Aig_ManObjNumMax(pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        pCnf->pObj2Count[pObj->Id] = 0;
+    // write the LUTs
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        if ( Vec_IntEntry(vMapping, i) == 0 )
+            continue;
+        pData = Vec_IntEntryP( vMapping, Vec_IntEntry(vMapping, i) );
+        for ( nFanins = 0; nFanins < nLutSize && pData[nFanins+1] >= 0; nFanins++ )
+            pFanins[nFanins] = pData[nFanins+1];
+        pCnf->pObj2Clause[i] = Vec_IntSize(vClas);
+        pCnf->pObj2Count[i]  = Cnf_DeriveLutClauses( Vec_WrdEntry(vTruths, pData[0]), Abc_Var2Lit(i, 0), pFanins, nFanins, vCover, vLits, vClas );
+    }
+    // write the output literals
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        pCnf->pObj2Clause[pObj->Id] = Vec_IntSize(vClas);
+        pCnf->pObj2Count[pObj->Id] = 2;
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, Abc_Var2Lit(pObj->Id, 0) );
+        Vec_IntPush( vLits, Abc_Var2Lit(Aig_ObjFaninId0(pObj), !Aig_ObjFaninC0(pObj)) );
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, Abc_Var2Lit(pObj->Id, 1) );
+        Vec_IntPush( vLits, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjFaninC0(pObj)) );
+    }
+    // write the constant literal
+    pObj = Aig_ManConst1(pAig);
+    pCnf->pObj2Clause[pObj->Id] = Vec_IntSize(vClas);
+    pCnf->pObj2Count[pObj->Id] = 1;
+    Vec_IntPush( vClas, Vec_IntSize(vLits) );
+    Vec_IntPush( vLits, Abc_Var2Lit(pObj->Id, 0) );
+    // create the clause array
+    pCnf->nLiterals = Vec_IntSize(vLits);
+    pCnf->nClauses  = Vec_IntSize(vClas);
+    pCnf->pClauses  = ABC_ALLOC( int *, pCnf->nClauses + 1 );
+    pCnf->pClauses[0] = Vec_IntReleaseArray( vLits );
+    Vec_IntForEachEntry( vClas, Entry, k )
+        pCnf->pClauses[k] = pCnf->pClauses[0] + Entry;
+    pCnf->pClauses[k] = pCnf->pClauses[0] + pCnf->nLiterals;
+    Vec_IntFree( vClas );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vCover );
+    Vec_IntFree( vMapping );
+    Vec_WrdFree( vTruths );
+    return pCnf;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
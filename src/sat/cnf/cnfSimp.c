@@ -0,0 +1,875 @@
+/**CFile****************************************************************
+
+  FileName    [cnfSimp.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [CNF preprocessing before loading into the SAT solver.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfSimp.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "misc/vec/vecWec.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The simplifier works on the flat clause array of Cnf_Dat_t and rewrites
+    it in place.  It performs unit propagation, backward subsumption with
+    self-subsuming strengthening, bounded variable elimination (BVE) and
+    failed-literal probing.  Variables listed as frozen are never eliminated,
+    so their values in a satisfying assignment of the simplified CNF can be
+    used as values of the original CNF.  The values of eliminated variables
+    are not reconstructed; the caller should freeze every variable it reads
+    from the model (typically, the CI variables) and every variable it adds
+    clauses or assumptions on later (typically, the CO variables).
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Cnf_Simp_t_ Cnf_Simp_t;
+struct Cnf_Simp_t_
+{
+    Cnf_SimpPars_t * pPars;     // parameters
+    int              nVars;     // the number of variables
+    int              fUnsat;    // the CNF is proved UNSAT
+    Vec_Wec_t *      vClauses;  // clause literals
+    Vec_Str_t *      vDead;     // deleted clauses
+    Vec_Wrd_t *      vSigns;    // clause signatures
+    Vec_Wec_t *      vOccurs;   // clauses of each literal (may contain deleted ones)
+    Vec_Int_t *      vOccNums;  // the number of live clauses of each literal
+    Vec_Int_t *      vValues;   // variable values (-1 = unassigned)
+    Vec_Str_t *      vFrozen;   // frozen variables
+    Vec_Str_t *      vElim;     // eliminated variables
+    Vec_Int_t *      vMarks;    // literal stamps
+    int              nStamp;    // the current stamp
+    Vec_Int_t *      vUnits;    // unit literals to be propagated
+    Vec_Int_t *      vQueue;    // clauses to be checked for subsumption
+    Vec_Str_t *      vQueued;   // clauses currently in the queue
+    Vec_Int_t *      vTemp;     // temporary storage
+    Vec_Int_t *      vRes;      // temporary storage
+    Vec_Int_t *      vLits;     // resolvent literals
+    Vec_Int_t *      vProbe;    // literal values during probing
+    Vec_Int_t *      vTrail;    // literals assigned during probing
+    // statistics
+    int              nUnits;
+    int              nSubsumed;
+    int              nStrengthened;
+    int              nEliminated;
+    int              nResolvents;
+    int              nFailed;
+    int              nNecessary;
+};
+
+static inline Vec_Int_t * Cnf_SimpClause( Cnf_Simp_t * p, int c )         { return Vec_WecEntry(p->vClauses, c);           }
+static inline int         Cnf_SimpIsDead( Cnf_Simp_t * p, int c )         { return Vec_StrEntry(p->vDead, c);              }
+static inline Vec_Int_t * Cnf_SimpOccur( Cnf_Simp_t * p, int Lit )        { return Vec_WecEntry(p->vOccurs, Lit);          }
+static inline int         Cnf_SimpOccNum( Cnf_Simp_t * p, int Lit )       { return Vec_IntEntry(p->vOccNums, Lit);         }
+static inline int         Cnf_SimpValue( Cnf_Simp_t * p, int Lit )        { int v = Vec_IntEntry(p->vValues, Abc_Lit2Var(Lit)); return v == -1 ? -1 : v ^ Abc_LitIsCompl(Lit); }
+static inline int         Cnf_SimpIsFrozen( Cnf_Simp_t * p, int v )       { return Vec_StrEntry(p->vFrozen, v);            }
+static inline int         Cnf_SimpIsElim( Cnf_Simp_t * p, int v )         { return Vec_StrEntry(p->vElim, v);              }
+static inline void        Cnf_SimpStampNew( Cnf_Simp_t * p )              { p->nStamp++;                                   }
+static inline void        Cnf_SimpStampSet( Cnf_Simp_t * p, int Lit )     { Vec_IntWriteEntry(p->vMarks, Lit, p->nStamp);  }
+static inline int         Cnf_SimpStampHas( Cnf_Simp_t * p, int Lit )     { return Vec_IntEntry(p->vMarks, Lit) == p->nStamp; }
+
+static inline word        Cnf_SimpSignLit( int Lit )                      { return ((word)1) << (Abc_Lit2Var(Lit) & 63);   }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the default parameters of CNF simplification.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_SimpSetDefaultParams( Cnf_SimpPars_t * pPars )
+{
+    memset( pPars, 0, sizeof(Cnf_SimpPars_t) );
+    pPars->nResolveMax  =       20;  // the largest resolvent allowed during elimination
+    pPars->nOccurMax    =       16;  // the largest number of occurrences of an eliminated variable
+    pPars->nSubsumeMax  = 10000000;  // the limit on the number of subsumption checks
+    pPars->nProbeProps  = 10000000;  // the limit on the number of clause visits during probing
+    pPars->nRounds      =        3;  // the number of elimination rounds
+    pPars->fElim        =        1;  // performs bounded variable elimination
+    pPars->fSubsume     =        1;  // performs subsumption and strengthening
+    pPars->fProbe       =        1;  // performs failed-literal probing
+    pPars->fVerbose     =        0;  // verbose output
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the simplification manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Simp_t * Cnf_SimpStart( int nVars, int nClauses, Cnf_SimpPars_t * pPars )
+{
+    Cnf_Simp_t * p = ABC_CALLOC( Cnf_Simp_t, 1 );
+    p->pPars    = pPars;
+    p->nVars    = nVars;
+    p->vClauses = Vec_WecAlloc( nClauses + 100 );
+    p->vDead    = Vec_StrAlloc( nClauses + 100 );
+    p->vSigns   = Vec_WrdAlloc( nClauses + 100 );
+    p->vOccurs  = Vec_WecStart( 2 * nVars );
+    p->vOccNums = Vec_IntStart( 2 * nVars );
+    p->vValues  = Vec_IntStartFull( nVars );
+    p->vFrozen  = Vec_StrStart( nVars );
+    p->vElim    = Vec_StrStart( nVars );
+    p->vMarks   = Vec_IntStart( 2 * nVars );
+    p->vUnits   = Vec_IntAlloc( 100 );
+    p->vQueue   = Vec_IntAlloc( nClauses + 100 );
+    p->vQueued  = Vec_StrAlloc( nClauses + 100 );
+    p->vTemp    = Vec_IntAlloc( 100 );
+    p->vRes     = Vec_IntAlloc( 100 );
+    p->vLits    = Vec_IntAlloc( 100 );
+    p->vProbe   = Vec_IntStart( 2 * nVars );
+    p->vTrail   = Vec_IntAlloc( 100 );
+    return p;
+}
+static void Cnf_SimpStop( Cnf_Simp_t * p )
+{
+    Vec_WecFree( p->vClauses );
+    Vec_StrFree( p->vDead );
+    Vec_WrdFree( p->vSigns );
+    Vec_WecFree( p->vOccurs );
+    Vec_IntFree( p->vOccNums );
+    Vec_IntFree( p->vValues );
+    Vec_StrFree( p->vFrozen );
+    Vec_StrFree( p->vElim );
+    Vec_IntFree( p->vMarks );
+    Vec_IntFree( p->vUnits );
+    Vec_IntFree( p->vQueue );
+    Vec_StrFree( p->vQueued );
+    Vec_IntFree( p->vTemp );
+    Vec_IntFree( p->vRes );
+    Vec_IntFree( p->vLits );
+    Vec_IntFree( p->vProbe );
+    Vec_IntFree( p->vTrail );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records a unit literal.]
+
+  Description [Returns 0 if the literal conflicts with the current assignment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpAssign( Cnf_Simp_t * p, int Lit )
+{
+    int Value = Cnf_SimpValue( p, Lit );
+    if ( Value == 1 )
+        return 1;
+    if ( Value == 0 )
+    {
+        p->fUnsat = 1;
+        return 0;
+    }
+    assert( !Cnf_SimpIsElim(p, Abc_Lit2Var(Lit)) );
+    Vec_IntWriteEntry( p->vValues, Abc_Lit2Var(Lit), !Abc_LitIsCompl(Lit) );
+    Vec_IntPush( p->vUnits, Lit );
+    p->nUnits++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds or removes clauses.]
+
+  Description [The literals of the clause are expected to be sorted,
+  unique, non-complementary and unassigned.  Units are assigned rather
+  than stored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_SimpQueue( Cnf_Simp_t * p, int c )
+{
+    if ( Vec_StrEntry(p->vQueued, c) )
+        return;
+    Vec_StrWriteEntry( p->vQueued, c, 1 );
+    Vec_IntPush( p->vQueue, c );
+}
+static int Cnf_SimpAddClause( Cnf_Simp_t * p, Vec_Int_t * vLits )
+{
+    Vec_Int_t * vClause;
+    word Sign = 0;
+    int i, Lit, c;
+    if ( Vec_IntSize(vLits) == 0 )
+    {
+        p->fUnsat = 1;
+        return -1;
+    }
+    if ( Vec_IntSize(vLits) == 1 )
+    {
+        Cnf_SimpAssign( p, Vec_IntEntry(vLits, 0) );
+        return -1;
+    }
+    c = Vec_WecSize( p->vClauses );
+    vClause = Vec_WecPushLevel( p->vClauses );
+    Vec_IntForEachEntry( vLits, Lit, i )
+    {
+        Vec_IntPush( vClause, Lit );
+        Vec_WecPush( p->vOccurs, Lit, c );
+        Vec_IntAddToEntry( p->vOccNums, Lit, 1 );
+        Sign |= Cnf_SimpSignLit( Lit );
+    }
+    Vec_StrPush( p->vDead, 0 );
+    Vec_WrdPush( p->vSigns, Sign );
+    Vec_StrPush( p->vQueued, 0 );
+    Cnf_SimpQueue( p, c );
+    return c;
+}
+static void Cnf_SimpRemoveClause( Cnf_Simp_t * p, int c )
+{
+    int i, Lit;
+    assert( !Cnf_SimpIsDead(p, c) );
+    Vec_StrWriteEntry( p->vDead, c, 1 );
+    Vec_IntForEachEntry( Cnf_SimpClause(p, c), Lit, i )
+        Vec_IntAddToEntry( p->vOccNums, Lit, -1 );
+}
+// removes deleted clauses from the occurrence list
+static Vec_Int_t * Cnf_SimpOccurClean( Cnf_Simp_t * p, int Lit )
+{
+    Vec_Int_t * vOcc = Cnf_SimpOccur( p, Lit );
+    int i, c, k = 0;
+    Vec_IntForEachEntry( vOcc, c, i )
+        if ( !Cnf_SimpIsDead(p, c) )
+            Vec_IntWriteEntry( vOcc, k++, c );
+    Vec_IntShrink( vOcc, k );
+    assert( k == Cnf_SimpOccNum(p, Lit) );
+    return vOcc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes one literal from the clause.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_SimpStrengthen( Cnf_Simp_t * p, int c, int Lit )
+{
+    Vec_Int_t * vClause = Cnf_SimpClause( p, c );
+    word Sign = 0;
+    int i, Temp;
+    assert( !Cnf_SimpIsDead(p, c) );
+    Vec_IntRemove( vClause, Lit );
+    Vec_IntRemove( Cnf_SimpOccur(p, Lit), c );
+    Vec_IntAddToEntry( p->vOccNums, Lit, -1 );
+    if ( Vec_IntSize(vClause) == 1 )
+    {
+        Cnf_SimpAssign( p, Vec_IntEntry(vClause, 0) );
+        Cnf_SimpRemoveClause( p, c );
+        return;
+    }
+    Vec_IntForEachEntry( vClause, Temp, i )
+        Sign |= Cnf_SimpSignLit( Temp );
+    Vec_WrdWriteEntry( p->vSigns, c, Sign );
+    Cnf_SimpQueue( p, c );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates unit literals through the clause database.]
+
+  Description [Returns 0 if the CNF is UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpPropagate( Cnf_Simp_t * p )
+{
+    Vec_Int_t * vOcc;
+    int i, c, Lit, iHead = 0;
+    while ( !p->fUnsat && iHead < Vec_IntSize(p->vUnits) )
+    {
+        Lit = Vec_IntEntry( p->vUnits, iHead++ );
+        // satisfied clauses
+        vOcc = Cnf_SimpOccur( p, Lit );
+        Vec_IntForEachEntry( vOcc, c, i )
+            if ( !Cnf_SimpIsDead(p, c) )
+                Cnf_SimpRemoveClause( p, c );
+        Vec_IntErase( vOcc );
+        // falsified literals
+        vOcc = Cnf_SimpOccurClean( p, Abc_LitNot(Lit) );
+        Vec_IntClear( p->vTemp );
+        Vec_IntAppend( p->vTemp, vOcc );
+        Vec_IntErase( vOcc );
+        Vec_IntForEachEntry( p->vTemp, c, i )
+            if ( !Cnf_SimpIsDead(p, c) )
+                Cnf_SimpStrengthen( p, c, Abc_LitNot(Lit) );
+    }
+    Vec_IntClear( p->vUnits );
+    return !p->fUnsat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs backward subsumption and strengthening.]
+
+  Description [Each queued clause is used to remove the clauses it
+  subsumes and to strengthen the clauses it subsumes after flipping
+  exactly one literal (self-subsuming resolution).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpSubsumeOne( Cnf_Simp_t * p, int c, int * pnChecks )
+{
+    Vec_Int_t * vClause = Cnf_SimpClause( p, c ), * vOther;
+    word Sign = Vec_WrdEntry( p->vSigns, c );
+    int i, k, d, Lit, Temp, LitBest = -1, nOccBest = ABC_INFINITY, LitFlip;
+    // select the variable with the fewest occurrences
+    Vec_IntForEachEntry( vClause, Lit, i )
+    {
+        int nOcc = Cnf_SimpOccNum(p, Lit) + Cnf_SimpOccNum(p, Abc_LitNot(Lit));
+        if ( nOccBest > nOcc )
+            nOccBest = nOcc, LitBest = Lit;
+    }
+    // collect the candidates
+    Vec_IntClear( p->vRes );
+    Vec_IntAppend( p->vRes, Cnf_SimpOccurClean(p, LitBest) );
+    Vec_IntAppend( p->vRes, Cnf_SimpOccurClean(p, Abc_LitNot(LitBest)) );
+    Vec_IntForEachEntry( p->vRes, d, i )
+    {
+        if ( d == c || Cnf_SimpIsDead(p, d) || Cnf_SimpIsDead(p, c) )
+            continue;
+        vOther = Cnf_SimpClause( p, d );
+        if ( Vec_IntSize(vOther) < Vec_IntSize(vClause) || (Sign & ~Vec_WrdEntry(p->vSigns, d)) )
+            continue;
+        if ( (*pnChecks)++ >= p->pPars->nSubsumeMax )
+            return 0;
+        Cnf_SimpStampNew( p );
+        Vec_IntForEachEntry( vOther, Temp, k )
+            Cnf_SimpStampSet( p, Temp );
+        LitFlip = -1;
+        Vec_IntForEachEntry( vClause, Lit, k )
+        {
+            if ( Cnf_SimpStampHas(p, Lit) )
+                continue;
+            if ( LitFlip == -1 && Cnf_SimpStampHas(p, Abc_LitNot(Lit)) )
+            {
+                LitFlip = Lit;
+                continue;
+            }
+            break;
+        }
+        if ( k < Vec_IntSize(vClause) )
+            continue;
+        if ( LitFlip == -1 )
+        {
+            Cnf_SimpRemoveClause( p, d );
+            p->nSubsumed++;
+        }
+        else
+        {
+            Cnf_SimpStrengthen( p, d, Abc_LitNot(LitFlip) );
+            p->nStrengthened++;
+        }
+    }
+    return 1;
+}
+static int Cnf_SimpSubsume( Cnf_Simp_t * p, int * pnChecks )
+{
+    int c, iHead = 0;
+    while ( !p->fUnsat )
+    {
+        if ( Vec_IntSize(p->vUnits) && !Cnf_SimpPropagate(p) )
+            break;
+        if ( iHead == Vec_IntSize(p->vQueue) )
+            break;
+        c = Vec_IntEntry( p->vQueue, iHead++ );
+        Vec_StrWriteEntry( p->vQueued, c, 0 );
+        if ( Cnf_SimpIsDead(p, c) || !p->pPars->fSubsume || *pnChecks >= p->pPars->nSubsumeMax )
+            continue;
+        Cnf_SimpSubsumeOne( p, c, pnChecks );
+    }
+    // the remaining queue entries are dropped
+    Vec_IntForEachEntryStart( p->vQueue, c, iHead, iHead )
+        Vec_StrWriteEntry( p->vQueued, c, 0 );
+    Vec_IntClear( p->vQueue );
+    return !p->fUnsat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the resolvent of two clauses on the given variable.]
+
+  Description [Returns 0 if the resolvent is a tautology.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpResolve( Cnf_Simp_t * p, int c0, int c1, int iVar, Vec_Int_t * vLits )
+{
+    int i, Lit;
+    Vec_IntClear( vLits );
+    Cnf_SimpStampNew( p );
+    Vec_IntForEachEntry( Cnf_SimpClause(p, c0), Lit, i )
+        if ( Abc_Lit2Var(Lit) != iVar )
+            Cnf_SimpStampSet( p, Lit ), Vec_IntPush( vLits, Lit );
+    Vec_IntForEachEntry( Cnf_SimpClause(p, c1), Lit, i )
+    {
+        if ( Abc_Lit2Var(Lit) == iVar || Cnf_SimpStampHas(p, Lit) )
+            continue;
+        if ( Cnf_SimpStampHas(p, Abc_LitNot(Lit)) )
+            return 0;
+        Vec_IntPush( vLits, Lit );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tries to eliminate one variable.]
+
+  Description [The variable is eliminated if the number of non-tautological
+  resolvents does not exceed the number of clauses it occurs in and no
+  resolvent exceeds the size limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpEliminateVar( Cnf_Simp_t * p, int iVar )
+{
+    Vec_Int_t * vPos, * vNeg;
+    int i, k, c0, c1, nRes = 0, nResLits = 0, nLimit, nLimitLits = 0;
+    int LitPos = Abc_Var2Lit( iVar, 0 ), LitNeg = Abc_Var2Lit( iVar, 1 );
+    if ( Cnf_SimpOccNum(p, LitPos) + Cnf_SimpOccNum(p, LitNeg) > p->pPars->nOccurMax )
+        return 0;
+    vPos = Cnf_SimpOccurClean( p, LitPos );
+    vNeg = Cnf_SimpOccurClean( p, LitNeg );
+    nLimit = Vec_IntSize(vPos) + Vec_IntSize(vNeg);
+    Vec_IntForEachEntry( vPos, c0, i )
+        nLimitLits += Vec_IntSize( Cnf_SimpClause(p, c0) );
+    Vec_IntForEachEntry( vNeg, c1, k )
+        nLimitLits += Vec_IntSize( Cnf_SimpClause(p, c1) );
+    // count the resolvents
+    Vec_IntForEachEntry( vPos, c0, i )
+    Vec_IntForEachEntry( vNeg, c1, k )
+    {
+        if ( !Cnf_SimpResolve(p, c0, c1, iVar, p->vLits) )
+            continue;
+        nResLits += Vec_IntSize(p->vLits);
+        if ( ++nRes > nLimit || nResLits > nLimitLits || Vec_IntSize(p->vLits) > p->pPars->nResolveMax )
+            return 0;
+    }
+    // add the resolvents
+    Vec_IntClear( p->vTemp );
+    Vec_IntAppend( p->vTemp, vPos );
+    Vec_IntAppend( p->vTemp, vNeg );
+    Vec_IntForEachEntry( vPos, c0, i )
+    Vec_IntForEachEntry( vNeg, c1, k )
+    {
+        if ( !Cnf_SimpResolve(p, c0, c1, iVar, p->vLits) )
+            continue;
+        Vec_IntSort( p->vLits, 0 );
+        Cnf_SimpAddClause( p, p->vLits );
+        p->nResolvents++;
+    }
+    // remove the original clauses
+    Vec_IntForEachEntry( p->vTemp, c0, i )
+        Cnf_SimpRemoveClause( p, c0 );
+    Vec_IntErase( Cnf_SimpOccur(p, LitPos) );
+    Vec_IntErase( Cnf_SimpOccur(p, LitNeg) );
+    Vec_StrWriteEntry( p->vElim, iVar, 1 );
+    p->nEliminated++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of bounded variable elimination.]
+
+  Description [Variables are tried in the order of the increasing product
+  of the positive and negative occurrence counts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_SimpEliminate( Cnf_Simp_t * p, int * pnChecks )
+{
+    Vec_Int_t * vOrder = Vec_IntAlloc( p->nVars );
+    Vec_Wrd_t * vCosts = Vec_WrdAlloc( p->nVars );
+    int i, iVar, nElimOld = p->nEliminated;
+    for ( iVar = 0; iVar < p->nVars; iVar++ )
+    {
+        word nPos = Cnf_SimpOccNum(p, Abc_Var2Lit(iVar, 0));
+        word nNeg = Cnf_SimpOccNum(p, Abc_Var2Lit(iVar, 1));
+        if ( Cnf_SimpIsFrozen(p, iVar) || Cnf_SimpIsElim(p, iVar) || Vec_IntEntry(p->vValues, iVar) != -1 )
+            continue;
+        if ( nPos + nNeg == 0 || (int)(nPos + nNeg) > p->pPars->nOccurMax )
+            continue;
+        Vec_WrdPush( vCosts, ((nPos * nNeg) << 32) | (word)iVar );
+    }
+    Vec_WrdSort( vCosts, 0 );
+    for ( i = 0; i < Vec_WrdSize(vCosts); i++ )
+        Vec_IntPush( vOrder, (int)(Vec_WrdEntry(vCosts, i) & 0xFFFFFFFF) );
+    Vec_WrdFree( vCosts );
+    Vec_IntForEachEntry( vOrder, iVar, i )
+    {
+        if ( Vec_IntEntry(p->vValues, iVar) != -1 )
+            continue;
+        if ( Cnf_SimpEliminateVar(p, iVar) && !Cnf_SimpSubsume(p, pnChecks) )
+            break;
+    }
+    Vec_IntFree( vOrder );
+    return p->nEliminated - nElimOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the literal without changing the clauses.]
+
+  Description [Returns 0 if a conflict is found.  The implied literals
+  are recorded in the trail.  Decrements the budget of clause visits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cnf_SimpProbeValue( Cnf_Simp_t * p, int Lit )
+{
+    int Value = Cnf_SimpValue( p, Lit );
+    if ( Value != -1 )
+        return Value;
+    if ( Vec_IntEntry(p->vProbe, Lit) )
+        return 1;
+    if ( Vec_IntEntry(p->vProbe, Abc_LitNot(Lit)) )
+        return 0;
+    return -1;
+}
+static int Cnf_SimpProbe( Cnf_Simp_t * p, int LitStart, int * pnBudget )
+{
+    int i, k, c, Lit, Temp, Value, LitFree, iHead = 0;
+    Vec_IntClear( p->vTrail );
+    Vec_IntWriteEntry( p->vProbe, LitStart, 1 );
+    Vec_IntPush( p->vTrail, LitStart );
+    while ( iHead < Vec_IntSize(p->vTrail) )
+    {
+        Lit = Vec_IntEntry( p->vTrail, iHead++ );
+        Vec_IntForEachEntry( Cnf_SimpOccur(p, Abc_LitNot(Lit)), c, i )
+        {
+            if ( Cnf_SimpIsDead(p, c) )
+                continue;
+            if ( --(*pnBudget) < 0 )
+                return 1;
+            LitFree = -1;
+            Vec_IntForEachEntry( Cnf_SimpClause(p, c), Temp, k )
+            {
+                Value = Cnf_SimpProbeValue( p, Temp );
+                if ( Value == 1 )
+                    break;
+                if ( Value == 0 )
+                    continue;
+                if ( LitFree != -1 )
+                    break;
+                LitFree = Temp;
+            }
+            if ( k < Vec_IntSize(Cnf_SimpClause(p, c)) )
+                continue;
+            if ( LitFree == -1 )
+                return 0;
+            Vec_IntWriteEntry( p->vProbe, LitFree, 1 );
+            Vec_IntPush( p->vTrail, LitFree );
+        }
+    }
+    return 1;
+}
+static void Cnf_SimpProbeUndo( Cnf_Simp_t * p )
+{
+    int i, Lit;
+    Vec_IntForEachEntry( p->vTrail, Lit, i )
+        Vec_IntWriteEntry( p->vProbe, Lit, 0 );
+    Vec_IntClear( p->vTrail );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs failed-literal probing.]
+
+  Description [A literal whose propagation leads to a conflict is asserted
+  in the opposite polarity.  A literal implied by both polarities of
+  the probed variable is asserted as well.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_SimpProbeAll( Cnf_Simp_t * p, int * pnChecks )
+{
+    int iVar, Lit, i, nBudget = p->pPars->nProbeProps;
+    for ( iVar = 0; iVar < p->nVars && nBudget > 0 && !p->fUnsat; iVar++ )
+    {
+        int LitPos = Abc_Var2Lit( iVar, 0 ), LitNeg = Abc_Var2Lit( iVar, 1 );
+        if ( Cnf_SimpIsElim(p, iVar) || Vec_IntEntry(p->vValues, iVar) != -1 )
+            continue;
+        // probing only makes sense for variables in both polarities
+        if ( Cnf_SimpOccNum(p, LitPos) == 0 || Cnf_SimpOccNum(p, LitNeg) == 0 )
+            continue;
+        if ( !Cnf_SimpProbe(p, LitPos, &nBudget) )
+        {
+            Cnf_SimpProbeUndo( p );
+            Cnf_SimpAssign( p, LitNeg );
+            p->nFailed++;
+            Cnf_SimpSubsume( p, pnChecks );
+            continue;
+        }
+        // remember the implications of the positive literal
+        Cnf_SimpStampNew( p );
+        Vec_IntForEachEntryStart( p->vTrail, Lit, i, 1 )
+            Cnf_SimpStampSet( p, Lit );
+        Cnf_SimpProbeUndo( p );
+        if ( !Cnf_SimpProbe(p, LitNeg, &nBudget) )
+        {
+            Cnf_SimpProbeUndo( p );
+            Cnf_SimpAssign( p, LitPos );
+            p->nFailed++;
+            Cnf_SimpSubsume( p, pnChecks );
+            continue;
+        }
+        // collect the literals implied by both polarities
+        Vec_IntClear( p->vLits );
+        Vec_IntForEachEntryStart( p->vTrail, Lit, i, 1 )
+            if ( Cnf_SimpStampHas(p, Lit) )
+                Vec_IntPush( p->vLits, Lit );
+        Cnf_SimpProbeUndo( p );
+        if ( Vec_IntSize(p->vLits) == 0 )
+            continue;
+        Vec_IntForEachEntry( p->vLits, Lit, i )
+            Cnf_SimpAssign( p, Lit );
+        p->nNecessary += Vec_IntSize(p->vLits);
+        Cnf_SimpSubsume( p, pnChecks );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses of the CNF into the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_SimpLoad( Cnf_Simp_t * p, Cnf_Dat_t * pCnf )
+{
+    int i, k, * pLit, * pStop;
+    for ( i = 0; i < pCnf->nClauses && !p->fUnsat; i++ )
+    {
+        Vec_IntClear( p->vLits );
+        for ( pLit = pCnf->pClauses[i], pStop = pCnf->pClauses[i+1]; pLit < pStop; pLit++ )
+            Vec_IntPush( p->vLits, *pLit );
+        Vec_IntSort( p->vLits, 0 );
+        Vec_IntUniqify( p->vLits );
+        // skip tautologies (complementary literals are adjacent after sorting)
+        for ( k = 1; k < Vec_IntSize(p->vLits); k++ )
+            if ( Vec_IntEntry(p->vLits, k-1) == Abc_LitNot(Vec_IntEntry(p->vLits, k)) )
+                break;
+        if ( k < Vec_IntSize(p->vLits) )
+            continue;
+        Cnf_SimpAddClause( p, p->vLits );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the simplified clauses back into the CNF.]
+
+  Description [Assigned variables that are not eliminated are written
+  as unit clauses.  An UNSAT CNF is written as two complementary units.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_SimpDump( Cnf_Simp_t * p, Cnf_Dat_t * pCnf )
+{
+    Vec_Int_t * vClause;
+    int i, k, c, Lit, Value, nClauses = 0, nLiterals = 0, * pLits;
+    if ( p->fUnsat )
+        nClauses = 2, nLiterals = 2;
+    else
+    {
+        Vec_IntForEachEntry( p->vValues, Value, i )
+            if ( Value != -1 )
+                nClauses++, nLiterals++;
+        Vec_WecForEachLevel( p->vClauses, vClause, c )
+            if ( !Cnf_SimpIsDead(p, c) )
+                nClauses++, nLiterals += Vec_IntSize(vClause);
+    }
+    ABC_FREE( pCnf->pClauses[0] );
+    ABC_FREE( pCnf->pClauses );
+    ABC_FREE( pCnf->pObj2Clause );
+    ABC_FREE( pCnf->pObj2Count );
+    ABC_FREE( pCnf->pClaPols );
+    pCnf->nClauses  = nClauses;
+    pCnf->nLiterals = nLiterals;
+    pCnf->pClauses  = ABC_ALLOC( int *, nClauses + 1 );
+    pCnf->pClauses[0] = pLits = ABC_ALLOC( int, Abc_MaxInt(nLiterals, 1) );
+    nClauses = 0;
+    if ( p->fUnsat )
+    {
+        pCnf->pClauses[nClauses++] = pLits;  *pLits++ = Abc_Var2Lit( 0, 0 );
+        pCnf->pClauses[nClauses++] = pLits;  *pLits++ = Abc_Var2Lit( 0, 1 );
+    }
+    else
+    {
+        Vec_IntForEachEntry( p->vValues, Value, i )
+            if ( Value != -1 )
+            {
+                pCnf->pClauses[nClauses++] = pLits;
+                *pLits++ = Abc_Var2Lit( i, !Value );
+            }
+        Vec_WecForEachLevel( p->vClauses, vClause, c )
+        {
+            if ( Cnf_SimpIsDead(p, c) )
+                continue;
+            pCnf->pClauses[nClauses++] = pLits;
+            Vec_IntForEachEntry( vClause, Lit, k )
+                *pLits++ = Lit;
+        }
+    }
+    assert( nClauses == pCnf->nClauses );
+    assert( pLits - pCnf->pClauses[0] == pCnf->nLiterals );
+    pCnf->pClauses[nClauses] = pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simplifies the CNF in place.]
+
+  Description [Variables in vFrozen (if given) are not eliminated.  The
+  variable numbering and the node-to-variable map are preserved, while
+  the clause-level maps (pObj2Clause, pObj2Count, pClaPols) are freed,
+  because they no longer apply.  Returns 0 if the CNF is found UNSAT;
+  in this case, the CNF is replaced by two complementary unit clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DataSimplify( Cnf_Dat_t * pCnf, Vec_Int_t * vFrozen, Cnf_SimpPars_t * pPars )
+{
+    Cnf_SimpPars_t Pars;
+    Cnf_Simp_t * p;
+    abctime clk = Abc_Clock();
+    int i, iVar, RetValue, nChecks = 0, nVarsElim = 0, nRound;
+    int nClausesOld = pCnf->nClauses, nLiteralsOld = pCnf->nLiterals;
+    if ( pPars == NULL )
+        Cnf_SimpSetDefaultParams( pPars = &Pars );
+    p = Cnf_SimpStart( pCnf->nVars, pCnf->nClauses, pPars );
+    if ( vFrozen )
+        Vec_IntForEachEntry( vFrozen, iVar, i )
+            if ( iVar >= 0 && iVar < p->nVars )
+                Vec_StrWriteEntry( p->vFrozen, iVar, 1 );
+    Cnf_SimpLoad( p, pCnf );
+    Cnf_SimpSubsume( p, &nChecks );
+    for ( nRound = 0; nRound < pPars->nRounds && pPars->fElim && !p->fUnsat; nRound++ )
+    {
+        nVarsElim = Cnf_SimpEliminate( p, &nChecks );
+        if ( nVarsElim == 0 )
+            break;
+    }
+    if ( pPars->fProbe && !p->fUnsat )
+        Cnf_SimpProbeAll( p, &nChecks );
+    Cnf_SimpDump( p, pCnf );
+    RetValue = !p->fUnsat;
+    if ( pPars->fVerbose )
+    {
+        printf( "CNF simplification:  Vars = %d. Clauses = %d -> %d (%6.2f %%). Literals = %d -> %d (%6.2f %%).\n",
+            pCnf->nVars, nClausesOld, pCnf->nClauses, 100.0 * pCnf->nClauses / Abc_MaxInt(nClausesOld, 1),
+            nLiteralsOld, pCnf->nLiterals, 100.0 * pCnf->nLiterals / Abc_MaxInt(nLiteralsOld, 1) );
+        printf( "Units = %d. Subsumed = %d. Strengthened = %d. Eliminated = %d. Resolvents = %d. Failed = %d. Necessary = %d.  %s  ",
+            p->nUnits, p->nSubsumed, p->nStrengthened, p->nEliminated, p->nResolvents, p->nFailed, p->nNecessary, RetValue ? "" : "UNSAT" );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Cnf_SimpStop( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the variables of CIs and COs of the AIG.]
+
+  Description [These variables are frozen when the CNF of a miter is
+  simplified, so that the counter-example can be read from the CIs and
+  the outputs can be constrained by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cnf_DataCollectFrozen( Cnf_Dat_t * pCnf, Aig_Man_t * p )
+{
+    Vec_Int_t * vFrozen = Vec_IntAlloc( Aig_ManCiNum(p) + Aig_ManCoNum(p) );
+    Aig_Obj_t * pObj;
+    int i;
+    Aig_ManForEachCi( p, pObj, i )
+        if ( pCnf->pVarNums[pObj->Id] >= 0 )
+            Vec_IntPush( vFrozen, pCnf->pVarNums[pObj->Id] );
+    Aig_ManForEachCo( p, pObj, i )
+        if ( pCnf->pVarNums[pObj->Id] >= 0 )
+            Vec_IntPush( vFrozen, pCnf->pVarNums[pObj->Id] );
+    return vFrozen;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+